@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+#include "bench_plugins.h"
+#include "module_graph.h"
+#include "module_metadata.h"
+
+using namespace ModuleLib;
+
+// Discovery over the synthetic corpus: metadata for every module, then the
+// dependency graph built from it. Registered only when the corpus was
+// configured (-DLOGOS_MODULE_BENCH_CORPUS_SIZE=N), so default runs list neither.
+
+static void BM_FromDirectory_Corpus(benchmark::State& state) {
+    const std::string dir = corpusDirectory();
+    std::size_t modules = 0;
+    for (auto _ : state) {
+        std::vector<MetadataResult> results =
+            ModuleMetadata::fromDirectory(dir, {}, static_cast<unsigned>(state.range(0)));
+        modules = results.size();
+        benchmark::DoNotOptimize(results);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(modules));
+}
+
+static void BM_ModuleGraph_Corpus(benchmark::State& state) {
+    const std::vector<MetadataResult> results = ModuleMetadata::fromDirectory(corpusDirectory());
+    for (auto _ : state) {
+        ModuleGraph graph = ModuleGraph::fromMetadata(results);
+        if (!graph.isValid()) {
+            state.SkipWithError("corpus graph is invalid");
+            break;
+        }
+        benchmark::DoNotOptimize(graph.waves());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(results.size()));
+}
+
+static const bool s_corpusBenchmarksRegistered = [] {
+    if (corpusDirectory().empty())
+        return false;
+    benchmark::RegisterBenchmark("BM_FromDirectory_Corpus", BM_FromDirectory_Corpus)
+        ->Arg(1)->Arg(0)->UseRealTime();
+    benchmark::RegisterBenchmark("BM_ModuleGraph_Corpus", BM_ModuleGraph_Corpus);
+    return true;
+}();
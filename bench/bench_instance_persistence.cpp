@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+#include "instance_persistence.h"
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+using namespace ModuleLib::InstancePersistence;
+
+namespace {
+
+// A base directory whose "bench_module" already has state.range(0) instances
+struct PopulatedBase {
+    QTemporaryDir dir;
+
+    explicit PopulatedBase(int instances) {
+        for (int i = 0; i < instances; ++i) {
+            resolveInstance(dir.path(), "bench_module", ResolveMode::AlwaysCreate);
+        }
+    }
+
+    QString path() const { return dir.path(); }
+};
+
+} // namespace
+
+static void BM_ResolveInstance_ReuseOrCreate(benchmark::State& state) {
+    PopulatedBase base(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(resolveInstance(base.path(), "bench_module", ResolveMode::ReuseOrCreate));
+    }
+}
+BENCHMARK(BM_ResolveInstance_ReuseOrCreate)->Arg(1)->Arg(100);
+
+static void BM_ResolveInstance_UseExplicit(benchmark::State& state) {
+    PopulatedBase base(static_cast<int>(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(resolveInstance(base.path(), "bench_module", ResolveMode::UseExplicit, "explicit"));
+    }
+}
+BENCHMARK(BM_ResolveInstance_UseExplicit)->Arg(1)->Arg(100);
+
+// Each created instance is removed again out of the timed region, so the
+// module does not grow with the iteration count
+static void BM_ResolveInstance_AlwaysCreate(benchmark::State& state) {
+    PopulatedBase base(static_cast<int>(state.range(0)));
+    const QString registry = base.path() + "/bench_module/" + RegistryFileName;
+    QFile::copy(registry, registry + ".orig");
+    for (auto _ : state) {
+        InstanceInfo info = resolveInstance(base.path(), "bench_module", ResolveMode::AlwaysCreate);
+
+        state.PauseTiming();
+        QDir(info.persistencePath).removeRecursively();
+        QFile::remove(registry);
+        QFile::copy(registry + ".orig", registry);
+        state.ResumeTiming();
+    }
+}
+BENCHMARK(BM_ResolveInstance_AlwaysCreate)->Arg(1)->Arg(100);
+
+static void BM_ResolveInstances_Batch(benchmark::State& state) {
+    QTemporaryDir dir;
+    std::vector<InstanceRequest> requests;
+    for (int i = 0; i < state.range(0); ++i) {
+        requests.push_back({QString("module_%1").arg(i), ResolveMode::ReuseOrCreate, QString()});
+    }
+    resolveInstances(dir.path(), requests);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(resolveInstances(dir.path(), requests));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ResolveInstances_Batch)->Arg(50);
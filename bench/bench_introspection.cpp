@@ -0,0 +1,138 @@
+#include <benchmark/benchmark.h>
+#include "bench_plugins.h"
+#include "logos_module.h"
+
+using namespace ModuleLib;
+
+namespace {
+
+using PluginPath = std::string (*)();
+
+// Load a plugin for the introspection benchmarks; skips the benchmark if the
+// plugin is missing or cannot be loaded here
+LogosModule loadForBench(benchmark::State& state, PluginPath plugin) {
+    const std::string path = plugin();
+    if (!pluginExists(path)) {
+        state.SkipWithError("plugin not found");
+        return LogosModule();
+    }
+    std::string error;
+    LogosModule module = LogosModule::loadFromPath(path, &error);
+    if (!module.isValid()) {
+        state.SkipWithError(("cannot load plugin: " + error).c_str());
+    }
+    return module;
+}
+
+} // namespace
+
+// dlopen + plugin constructor + unload. The library stays mapped by Qt, so
+// after the first iteration this is mostly instance creation.
+static void BM_LoadFromPath_Unload(benchmark::State& state, PluginPath plugin) {
+    const std::string path = plugin();
+    if (!pluginExists(path)) {
+        state.SkipWithError("plugin not found");
+        return;
+    }
+    for (auto _ : state) {
+        LogosModule module = LogosModule::loadFromPath(path);
+        if (!module.isValid()) {
+            state.SkipWithError("cannot load plugin");
+            break;
+        }
+        module.unload();
+    }
+}
+BENCHMARK_CAPTURE(BM_LoadFromPath_Unload, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_LoadFromPath_Unload, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_LoadFromPath_Unload, synthetic_provider, syntheticProviderPlugin);
+
+// Cold introspection: the shared caches are dropped every iteration, so each
+// call walks the QMetaObject / asks the provider again
+static void BM_GetMethods_Cold(benchmark::State& state, PluginPath plugin) {
+    LogosModule module = loadForBench(state, plugin);
+    if (!module.isValid()) {
+        return;
+    }
+    for (auto _ : state) {
+        LogosModule::clearIntrospectionCache();
+        benchmark::DoNotOptimize(LogosModule::getMethods(module.instance()));
+    }
+}
+BENCHMARK_CAPTURE(BM_GetMethods_Cold, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_GetMethods_Cold, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_GetMethods_Cold, synthetic_provider, syntheticProviderPlugin);
+
+static void BM_GetMethodsAsJson_Cold(benchmark::State& state, PluginPath plugin) {
+    LogosModule module = loadForBench(state, plugin);
+    if (!module.isValid()) {
+        return;
+    }
+    for (auto _ : state) {
+        LogosModule::clearIntrospectionCache();
+        benchmark::DoNotOptimize(LogosModule::getMethodsAsJson(module.instance()));
+    }
+}
+BENCHMARK_CAPTURE(BM_GetMethodsAsJson_Cold, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_GetMethodsAsJson_Cold, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_GetMethodsAsJson_Cold, synthetic_provider, syntheticProviderPlugin);
+
+// Warm introspection through a handle, served from its interface cache
+static void BM_GetMethods_Handle(benchmark::State& state, PluginPath plugin) {
+    LogosModule module = loadForBench(state, plugin);
+    if (!module.isValid()) {
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(module.getMethods());
+    }
+}
+BENCHMARK_CAPTURE(BM_GetMethods_Handle, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_GetMethods_Handle, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_GetMethods_Handle, synthetic_provider, syntheticProviderPlugin);
+
+static void BM_GetMethodsAsJson_Handle(benchmark::State& state, PluginPath plugin) {
+    LogosModule module = loadForBench(state, plugin);
+    if (!module.isValid()) {
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(module.getMethodsAsJson());
+    }
+}
+BENCHMARK_CAPTURE(BM_GetMethodsAsJson_Handle, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_GetMethodsAsJson_Handle, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_GetMethodsAsJson_Handle, synthetic_provider, syntheticProviderPlugin);
+
+// Lookup of a method near the end of the interface, and of a missing one
+static void BM_HasMethod_Handle(benchmark::State& state, PluginPath plugin) {
+    LogosModule module = loadForBench(state, plugin);
+    if (!module.isValid()) {
+        return;
+    }
+    const std::vector<MethodInfo> methods = module.getMethods();
+    const QString present = methods.empty() ? QString("missing") : methods.back().name;
+    const QString missing("noSuchMethod");
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(module.hasMethod(present));
+        benchmark::DoNotOptimize(module.hasMethod(missing));
+    }
+}
+BENCHMARK_CAPTURE(BM_HasMethod_Handle, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_HasMethod_Handle, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_HasMethod_Handle, synthetic_provider, syntheticProviderPlugin);
+
+static void BM_HasMethod_Cold(benchmark::State& state, PluginPath plugin) {
+    LogosModule module = loadForBench(state, plugin);
+    if (!module.isValid()) {
+        return;
+    }
+    const QString missing("noSuchMethod");
+    for (auto _ : state) {
+        LogosModule::clearIntrospectionCache();
+        benchmark::DoNotOptimize(LogosModule::hasMethod(module.instance(), missing));
+    }
+}
+BENCHMARK_CAPTURE(BM_HasMethod_Cold, example, examplePlugin);
+BENCHMARK_CAPTURE(BM_HasMethod_Cold, synthetic_legacy, syntheticLegacyPlugin);
+BENCHMARK_CAPTURE(BM_HasMethod_Cold, synthetic_provider, syntheticProviderPlugin);
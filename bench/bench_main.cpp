@@ -0,0 +1,15 @@
+#include <benchmark/benchmark.h>
+#include <QCoreApplication>
+
+// Plugins may expect an application object, as they have under liblogos.
+int main(int argc, char** argv) {
+    QCoreApplication app(argc, argv);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    return 0;
+}
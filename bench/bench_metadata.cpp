@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+#include "bench_plugins.h"
+#include "logos_module.h"
+#include "metadata_cache.h"
+#include "module_metadata.h"
+#include <QJsonArray>
+#include <QJsonObject>
+
+using namespace ModuleLib;
+
+namespace {
+
+// Plugin metadata shaped like a real module's, with a few dependencies and
+// an extra field carried through rawMetadata
+QJsonObject pluginJson() {
+    QJsonObject custom;
+    custom["name"] = "bench_module";
+    custom["displayName"] = "Bench Module";
+    custom["version"] = "1.2.3";
+    custom["description"] = "Module used by the metadata benchmarks";
+    custom["author"] = "Logos";
+    custom["type"] = "core";
+    custom["dependencies"] = QJsonArray{"storage", "network", "identity"};
+    custom["capabilities"] = QJsonArray{"ui", "sync"};
+
+    QJsonObject json;
+    json["IID"] = "org.logos.Bench";
+    json["MetaData"] = custom;
+    return json;
+}
+
+void fromPath(benchmark::State& state, const std::string& path) {
+    if (!pluginExists(path)) {
+        state.SkipWithError("plugin not found");
+        return;
+    }
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ModuleMetadata::fromPath(path));
+    }
+}
+
+} // namespace
+
+static void BM_ModuleMetadata_FromJson(benchmark::State& state) {
+    const QJsonObject json = pluginJson();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ModuleMetadata::fromJson(json));
+    }
+}
+BENCHMARK(BM_ModuleMetadata_FromJson);
+
+static void BM_ModuleMetadata_FromCustomMetadata(benchmark::State& state) {
+    const QJsonObject custom = pluginJson()["MetaData"].toObject();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(ModuleMetadata::fromCustomMetadata(custom));
+    }
+}
+BENCHMARK(BM_ModuleMetadata_FromCustomMetadata);
+
+static void BM_ModuleMetadata_FromPath_Example(benchmark::State& state) {
+    fromPath(state, examplePlugin());
+}
+BENCHMARK(BM_ModuleMetadata_FromPath_Example);
+
+static void BM_ModuleMetadata_FromPath_SyntheticLegacy(benchmark::State& state) {
+    fromPath(state, syntheticLegacyPlugin());
+}
+BENCHMARK(BM_ModuleMetadata_FromPath_SyntheticLegacy);
+
+// extractMetadata() with the process-wide cache enabled: a stat per lookup
+static void BM_LogosModule_ExtractMetadata_Cached(benchmark::State& state) {
+    const std::string path = examplePlugin();
+    if (!pluginExists(path)) {
+        state.SkipWithError("plugin not found");
+        return;
+    }
+    MetadataCache::global().setEnabled(true);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(LogosModule::extractMetadata(path));
+    }
+    MetadataCache::global().setEnabled(false);
+    MetadataCache::global().clear();
+}
+BENCHMARK(BM_LogosModule_ExtractMetadata_Cached);
@@ -0,0 +1,48 @@
+#ifndef BENCH_PLUGINS_H
+#define BENCH_PLUGINS_H
+
+#include <QFile>
+#include <QString>
+#include <cstdlib>
+#include <string>
+
+// Plugins exercised by the benchmarks. The example plugin comes from
+// tests/examples ($TEST_PLUGIN overrides it, as in the tests); the synthetic
+// ones are generated by logos_add_synthetic_module() next to the benchmark.
+
+inline std::string benchPluginSuffix() {
+#ifdef __APPLE__
+    return ".dylib";
+#else
+    return ".so";
+#endif
+}
+
+inline std::string examplePlugin() {
+    const char* envPlugin = std::getenv("TEST_PLUGIN");
+    if (envPlugin && *envPlugin) {
+        return envPlugin;
+    }
+    return std::string(LOGOS_BENCH_EXAMPLES_DIR) + "/package_manager_plugin" + benchPluginSuffix();
+}
+
+// 400 Q_INVOKABLE methods, introspected through QMetaObject
+inline std::string syntheticLegacyPlugin() {
+    return std::string(LOGOS_BENCH_PLUGIN_DIR) + "/synthetic_legacy_plugin" + benchPluginSuffix();
+}
+
+// 400 methods served by a LogosProviderObject's getMethods()
+inline std::string syntheticProviderPlugin() {
+    return std::string(LOGOS_BENCH_PLUGIN_DIR) + "/synthetic_provider_plugin" + benchPluginSuffix();
+}
+
+// Directory of the synthetic corpus (LOGOS_MODULE_BENCH_CORPUS_SIZE); empty if none was built
+inline std::string corpusDirectory() {
+    return LOGOS_BENCH_CORPUS_DIR;
+}
+
+inline bool pluginExists(const std::string& path) {
+    return QFile::exists(QString::fromStdString(path));
+}
+
+#endif // BENCH_PLUGINS_H
@@ -0,0 +1,151 @@
+# Synthetic Qt plugins for benchmarking discovery and introspection at scale.
+#
+#   logos_add_synthetic_module(<name>
+#       [STYLE legacy|provider]      # Q_INVOKABLE methods, or a LogosProviderPlugin (default: legacy)
+#       [METHODS <n>]                # methods in the interface (default: 10)
+#       [METADATA_BYTES <n>]         # size of the "description" metadata field (default: 0)
+#       [DEPENDENCIES <module>...]   # "dependencies" metadata field
+#       [OUTPUT_DIRECTORY <dir>])    # default: ${CMAKE_CURRENT_BINARY_DIR}/plugins
+#
+# adds the MODULE library target <name>_plugin, built as <name>_plugin.so /
+# .dylib from synthetic_plugin.cpp.in with the module metadata embedded.
+#
+#   logos_add_synthetic_modules(<target> COUNT <n>
+#       [PREFIX <prefix>]            # module names are <prefix>_<i> (default: synthetic)
+#       [STYLE legacy|provider|mixed]  # mixed alternates, starting with legacy
+#       [METHODS <n>] [METADATA_BYTES <n>] [OUTPUT_DIRECTORY <dir>]
+#       [FANOUT <n>])                # dependencies per module (default: 0)
+#
+# adds <n> such modules and the custom target <target> that builds them all.
+# Module i depends on modules (i-1)/2, (i-1)/3, ... (i-1)/(FANOUT+1), so the
+# graph is acyclic, about log(n) levels deep, and the same on every build.
+
+set(_LOGOS_SYNTHETIC_TEMPLATE "${CMAKE_CURRENT_LIST_DIR}/synthetic_plugin.cpp.in")
+
+function(logos_add_synthetic_module NAME)
+    cmake_parse_arguments(ARG "" "STYLE;METHODS;METADATA_BYTES;OUTPUT_DIRECTORY" "DEPENDENCIES" ${ARGN})
+    if(NOT ARG_STYLE)
+        set(ARG_STYLE legacy)
+    endif()
+    if(NOT ARG_STYLE MATCHES "^(legacy|provider)$")
+        message(FATAL_ERROR "logos_add_synthetic_module: STYLE must be legacy or provider, got '${ARG_STYLE}'")
+    endif()
+    if(NOT DEFINED ARG_METHODS)
+        set(ARG_METHODS 10)
+    endif()
+    if(NOT ARG_OUTPUT_DIRECTORY)
+        set(ARG_OUTPUT_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/plugins")
+    endif()
+
+    string(MAKE_C_IDENTIFIER "${NAME}" SYNTHETIC_CLASS)
+    set(SYNTHETIC_CLASS "Synthetic_${SYNTHETIC_CLASS}")
+    set(SYNTHETIC_NAME "${NAME}")
+    set(SYNTHETIC_STYLE "${ARG_STYLE}")
+    set(SYNTHETIC_METHODS "${ARG_METHODS}")
+
+    # moc does not expand macros, so legacy methods are spelled out
+    set(SYNTHETIC_INVOKABLES "")
+    if(ARG_STYLE STREQUAL "legacy" AND ARG_METHODS GREATER 0)
+        math(EXPR last "${ARG_METHODS} - 1")
+        foreach(i RANGE ${last})
+            string(APPEND SYNTHETIC_INVOKABLES
+                "    Q_INVOKABLE QString method${i}(const QString& value) { return value; }\n")
+        endforeach()
+    endif()
+
+    set(description "Synthetic ${ARG_STYLE} plugin with ${ARG_METHODS} methods")
+    if(ARG_METADATA_BYTES)
+        string(LENGTH "${description}" length)
+        if(ARG_METADATA_BYTES GREATER length)
+            math(EXPR padding "${ARG_METADATA_BYTES} - ${length}")
+            string(REPEAT "." ${padding} dots)
+            string(APPEND description "${dots}")
+        endif()
+    endif()
+
+    set(dependencies "")
+    foreach(dependency IN LISTS ARG_DEPENDENCIES)
+        if(dependencies)
+            string(APPEND dependencies ", ")
+        endif()
+        string(APPEND dependencies "\"${dependency}\"")
+    endforeach()
+
+    # Written through configure_file so unchanged modules are not rebuilt
+    set(dir "${CMAKE_CURRENT_BINARY_DIR}/synthetic/${NAME}")
+    configure_file("${_LOGOS_SYNTHETIC_TEMPLATE}" "${dir}/${NAME}_plugin.cpp" @ONLY)
+    file(WRITE "${dir}/${NAME}_metadata.json.in"
+        "{\n  \"name\": \"${NAME}\",\n  \"version\": \"1.0.0\",\n"
+        "  \"description\": \"${description}\",\n"
+        "  \"author\": \"logos-module synthetic\",\n  \"type\": \"core\",\n"
+        "  \"dependencies\": [${dependencies}]\n}\n")
+    configure_file("${dir}/${NAME}_metadata.json.in" "${dir}/${NAME}_metadata.json" COPYONLY)
+
+    add_library(${NAME}_plugin MODULE "${dir}/${NAME}_plugin.cpp")
+    target_include_directories(${NAME}_plugin PRIVATE "${dir}" "${PROJECT_SOURCE_DIR}/src")
+    target_link_libraries(${NAME}_plugin PRIVATE Qt6::Core)
+    set_target_properties(${NAME}_plugin PROPERTIES
+        PREFIX ""
+        AUTOMOC ON
+        LIBRARY_OUTPUT_DIRECTORY "${ARG_OUTPUT_DIRECTORY}"
+    )
+endfunction()
+
+function(logos_add_synthetic_modules TARGET)
+    cmake_parse_arguments(ARG "" "COUNT;PREFIX;STYLE;METHODS;METADATA_BYTES;FANOUT;OUTPUT_DIRECTORY" "" ${ARGN})
+    if(NOT ARG_COUNT OR ARG_COUNT LESS 1)
+        message(FATAL_ERROR "logos_add_synthetic_modules: COUNT must be at least 1")
+    endif()
+    if(NOT ARG_PREFIX)
+        set(ARG_PREFIX synthetic)
+    endif()
+    if(NOT ARG_STYLE)
+        set(ARG_STYLE legacy)
+    endif()
+    if(NOT DEFINED ARG_METHODS)
+        set(ARG_METHODS 10)
+    endif()
+    if(NOT DEFINED ARG_METADATA_BYTES)
+        set(ARG_METADATA_BYTES 0)
+    endif()
+    if(NOT DEFINED ARG_FANOUT)
+        set(ARG_FANOUT 0)
+    endif()
+    if(NOT ARG_OUTPUT_DIRECTORY)
+        set(ARG_OUTPUT_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}")
+    endif()
+
+    add_custom_target(${TARGET})
+    math(EXPR last "${ARG_COUNT} - 1")
+    foreach(i RANGE ${last})
+        set(style "${ARG_STYLE}")
+        if(style STREQUAL "mixed")
+            math(EXPR odd "${i} % 2")
+            if(odd)
+                set(style provider)
+            else()
+                set(style legacy)
+            endif()
+        endif()
+
+        set(dependencies "")
+        if(i GREATER 0 AND ARG_FANOUT GREATER 0)
+            foreach(k RANGE 1 ${ARG_FANOUT})
+                math(EXPR dependency "(${i} - 1) / (${k} + 1)")
+                list(APPEND dependencies "${ARG_PREFIX}_${dependency}")
+            endforeach()
+            list(REMOVE_DUPLICATES dependencies)
+        endif()
+
+        logos_add_synthetic_module(${ARG_PREFIX}_${i}
+            STYLE ${style}
+            METHODS ${ARG_METHODS}
+            METADATA_BYTES ${ARG_METADATA_BYTES}
+            DEPENDENCIES ${dependencies}
+            OUTPUT_DIRECTORY "${ARG_OUTPUT_DIRECTORY}"
+        )
+        add_dependencies(${TARGET} ${ARG_PREFIX}_${i}_plugin)
+    endforeach()
+
+    set_target_properties(${TARGET} PROPERTIES SYNTHETIC_MODULES_DIRECTORY "${ARG_OUTPUT_DIRECTORY}")
+endfunction()
@@ -5,13 +5,30 @@
 #include <QJsonArray>
 #include <QStringList>
 #include <QFileInfo>
+#include <QDir>
+#include <QEventLoop>
+#include <QLibrary>
+#include <QProcess>
+#include <QRegularExpression>
+#include <QSet>
+#include <QThread>
+#include <QTimer>
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <vector>
 #include <string>
-#include <unistd.h>
-#include <fcntl.h>
+#include <unordered_map>
 
+#include "file_identity.h"
+#include "interface_sidecar.h"
+#include "isolated_introspection.h"
+#include "json_writer.h"
 #include "logos_module.h"
+#include "metadata_cache.h"
+#include "metadata_index.h"
 #include "module_metadata.h"
 
 using namespace ModuleLib;
@@ -24,6 +41,20 @@ const char* VERSION = "0.1.0";
 // Global flag for debug mode
 static bool g_debugMode = false;
 
+// Global flag for --timings: report the load and introspection phases
+static bool g_printTimings = false;
+
+// Global flag for --memory: report what the loaded plugin costs
+static bool g_printMemory = false;
+
+// How command results are printed: text, one indented JSON document, or
+// newline-delimited compact JSON records (--ndjson)
+enum class OutputMode {
+    Human,
+    Json,
+    Ndjson
+};
+
 // Custom Qt message handler to suppress debug/info messages unless in debug mode
 void customMessageHandler(QtMsgType type, const QMessageLogContext& context, const QString& msg) {
     if (!g_debugMode && (type == QtDebugMsg || type == QtInfoMsg)) {
@@ -69,10 +100,17 @@ void printUsage() {
         << "  metadata    Show plugin metadata (name, version, description, etc.)\n"
         << "  methods     Show plugin methods and signatures\n"
         << "  events      Show plugin events and signatures\n"
+        << "  index       Build or refresh the metadata index of a module directory\n"
+        << "  export-interface  Write a plugin's methods and events to its interface sidecar\n"
+        << "  scan        Inspect every plugin in directories or globs, in parallel\n"
+        << "  serve       Answer line-delimited JSON requests on stdin/stdout\n"
         << "\n"
         << "Options:\n"
         << "  --json      Output in JSON format\n"
+        << "  --ndjson    Output one compact JSON record per line (per method/event)\n"
         << "  --debug     Show debug output from plugin loading\n"
+        << "  --timings   Report how long each load and introspection phase took\n"
+        << "  --memory    Report the plugin's mapped size, RSS delta and cached bytes\n"
         << "  --help, -h  Show help information\n"
         << "  --version, -v  Show version information\n"
         << "\n"
@@ -82,7 +120,12 @@ void printUsage() {
         << "  lm metadata /path/to/plugin.so\n"
         << "  lm methods /path/to/plugin.so\n"
         << "  lm metadata /path/to/plugin.so --json\n"
-        << "  lm methods /path/to/plugin.so --json --debug\n";
+        << "  lm methods /path/to/plugin.so --json --debug\n"
+        << "  lm methods /path/to/plugin.so --ndjson | jq .name\n"
+        << "  lm /path/to/plugin.so --timings\n"
+        << "  lm index /path/to/modules\n"
+        << "  lm export-interface /path/to/plugin.so\n"
+        << "  lm scan /path/to/modules --jobs 8\n";
 }
 
 void printCommandHelp(const QString& command) {
@@ -94,6 +137,7 @@ void printCommandHelp(const QString& command) {
             << "\n"
             << "Options:\n"
             << "  --json   Output in JSON format\n"
+            << "  --ndjson Output one compact JSON record per line\n"
             << "  --debug  Show debug output from plugin loading\n";
     } else if (command == "methods") {
         out << "Usage: lm methods [options] <plugin-path>\n"
@@ -103,7 +147,10 @@ void printCommandHelp(const QString& command) {
             << "\n"
             << "Options:\n"
             << "  --json   Output in JSON format\n"
-            << "  --debug  Show debug output from plugin loading\n";
+            << "  --ndjson Output one compact JSON record per line\n"
+            << "  --debug  Show debug output from plugin loading\n"
+            << "  --timings  Print the load and introspection phase durations on stderr\n"
+            << "  --memory   Print the plugin's memory footprint on stderr\n";
     } else if (command == "events") {
         out << "Usage: lm events [options] <plugin-path>\n"
             << "\n"
@@ -112,7 +159,67 @@ void printCommandHelp(const QString& command) {
             << "\n"
             << "Options:\n"
             << "  --json   Output in JSON format\n"
+            << "  --ndjson Output one compact JSON record per line\n"
+            << "  --debug  Show debug output from plugin loading\n"
+            << "  --timings  Print the load and introspection phase durations on stderr\n"
+            << "  --memory   Print the plugin's memory footprint on stderr\n";
+    } else if (command == "index") {
+        out << "Usage: lm index [options] <module-dir>\n"
+            << "\n"
+            << "Build or refresh the metadata index (" << MetadataIndex::FileName << ")\n"
+            << "of a module directory. Metadata reads for plugins in that directory are\n"
+            << "then served from the index while the plugin files are unchanged.\n"
+            << "\n"
+            << "Options:\n"
+            << "  --json   Output in JSON format\n"
+            << "  --ndjson Output one compact JSON record per line\n"
+            << "  --debug  Show debug output from metadata extraction\n";
+    } else if (command == "export-interface") {
+        out << "Usage: lm export-interface [options] <plugin-path>\n"
+            << "\n"
+            << "Load the plugin and write its methods and events, with a checksum of\n"
+            << "the plugin binary, to <plugin base name>" << InterfaceSidecar::Suffix << "\n"
+            << "next to it. While the sidecar matches the binary, methods, events and\n"
+            << "the default command are answered from it without loading the plugin.\n"
+            << "\n"
+            << "Options:\n"
+            << "  --output, -o <file>  Write the sidecar to <file> instead\n"
+            << "  --json   Output in JSON format\n"
+            << "  --ndjson Output one compact JSON record per line\n"
             << "  --debug  Show debug output from plugin loading\n";
+    } else if (command == "scan") {
+        out << "Usage: lm scan [options] <dir|glob|plugin-path>...\n"
+            << "\n"
+            << "Inspect every plugin found in the given directories, globs (e.g.\n"
+            << "'modules/*_plugin.so') and paths. Each plugin is loaded in its own\n"
+            << "worker process, so a plugin that crashes or hangs fails only its own\n"
+            << "record. Prints a JSON array of records in input order, or one compact\n"
+            << "record per line as workers finish with --ndjson. Exits with 1 if any\n"
+            << "plugin failed.\n"
+            << "\n"
+            << "Options:\n"
+            << "  --metadata-only  Read metadata without loading plugins (no workers)\n"
+            << "  --jobs <n>       Number of parallel workers (default: CPU count)\n"
+            << "  --timeout <s>    Per-plugin worker timeout in seconds (default: 30)\n"
+            << "  --timings        Add each plugin's phase durations to its record (\"timings\")\n"
+            << "  --memory         Add each plugin's memory footprint to its record (\"memory\")\n"
+            << "  --ndjson         Output one JSON record per line\n"
+            << "  --debug          Show debug output\n";
+    } else if (command == "serve") {
+        out << "Usage: lm serve [options]\n"
+            << "\n"
+            << "Read one JSON request per line from stdin and write one compact JSON\n"
+            << "response per line to stdout. Plugins stay loaded and metadata stays\n"
+            << "cached between requests; a plugin file that changes on disk is\n"
+            << "reloaded on its next request. Ends at EOF or on a shutdown request.\n"
+            << "\n"
+            << "Request:  {\"id\": 1, \"command\": \"methods\", \"path\": \"/path/to/plugin.so\"}\n"
+            << "Commands: metadata, methods, events, info, shutdown\n"
+            << "Response: {\"id\": 1, \"ok\": true, \"result\": ...}\n"
+            << "          {\"id\": 1, \"ok\": false, \"error\": \"...\"}\n"
+            << "\n"
+            << "Options:\n"
+            << "  --debug  Show debug output (on stderr)\n";
     }
 }
 
@@ -134,7 +241,7 @@ void printMetadataHuman(const ModuleMetadata& metadata) {
     // number governing load/call compatibility (same MAJOR <=> compatible).
     // Modules from pre-protocol builders have no stamp.
     const QString protocolVersion = metadata.rawMetadata
-        .value(QStringLiteral("logos_protocol_version")).toString();
+        .value(QLatin1String(metadataKey(MetadataField::ProtocolVersion))).toString();
     out << "Protocol:     "
         << (protocolVersion.isEmpty()
                 ? QStringLiteral("(unstamped — pre-protocol build)")
@@ -148,30 +255,58 @@ void printMetadataHuman(const ModuleMetadata& metadata) {
     }
 }
 
-void printMetadataJson(const ModuleMetadata& metadata) {
-    QJsonObject obj;
-    obj["name"] = metadata.name;
+// Write the metadata summary shared by `metadata --json` and `info --json`.
+// Keys are written in sorted order, the layout QJsonDocument used to produce.
+void writeMetadataJson(JsonWriter& writer, const ModuleMetadata& metadata, bool withProtocolVersion) {
+    writer.beginObject();
+    writer.key("author").value(metadata.author);
+    writer.key("dependencies").beginArray();
+    for (const QString& dep : metadata.dependencies) {
+        writer.value(dep);
+    }
+    writer.endArray();
+    writer.key("description").value(metadata.description);
     if (!metadata.displayName.isEmpty())
-        obj["display_name"] = metadata.displayName;
-    obj["version"] = metadata.version;
-    obj["description"] = metadata.description;
-    obj["author"] = metadata.author;
-    obj["type"] = metadata.type;
-    {
+        writer.key("display_name").value(metadata.displayName);
+    if (withProtocolVersion) {
         const QString protocolVersion = metadata.rawMetadata
-            .value(QStringLiteral("logos_protocol_version")).toString();
+            .value(QLatin1String(metadataKey(MetadataField::ProtocolVersion))).toString();
         if (!protocolVersion.isEmpty())
-            obj["logos_protocol_version"] = protocolVersion;
+            writer.key("logos_protocol_version").value(protocolVersion);
     }
+    writer.key("name").value(metadata.name);
+    writer.key("type").value(metadata.type);
+    writer.key("version").value(metadata.version);
+    writer.endObject();
+}
 
-    QJsonArray deps;
-    for (const QString& dep : metadata.dependencies) {
-        deps.append(dep);
+void printJsonText(const std::string& text) {
+    out << QByteArray::fromRawData(text.data(), static_cast<qsizetype>(text.size()));
+}
+
+// Print one compact JSON record on its own line and flush it, so NDJSON
+// consumers can start on it before the rest of the output exists.
+template <typename Write>
+void printNdjsonRecord(Write write) {
+    std::string line;
+    JsonWriter writer(line, JsonFormat::Compact);
+    write(writer);
+    line += '\n';
+    printJsonText(line);
+    out.flush();
+}
+
+void printNdjsonRecords(const QJsonArray& records) {
+    for (const QJsonValue& record : records) {
+        printNdjsonRecord([&](JsonWriter& writer) { writer.value(record); });
     }
-    obj["dependencies"] = deps;
-    
-    QJsonDocument doc(obj);
-    out << doc.toJson(QJsonDocument::Indented);
+}
+
+void printMetadataJson(const ModuleMetadata& metadata) {
+    std::string text;
+    JsonWriter writer(text);
+    writeMetadataJson(writer, metadata, /*withProtocolVersion=*/true);
+    printJsonText(text);
 }
 
 void printMethodsHuman(const std::vector<MethodInfo>& methods) {
@@ -211,10 +346,8 @@ void printMethodsHuman(const std::vector<MethodInfo>& methods) {
     }
 }
 
-void printMethodsJson(QObject* plugin) {
-    QJsonArray methodsArray = LogosModule::getMethodsAsJson(plugin);
-    QJsonDocument doc(methodsArray);
-    out << doc.toJson(QJsonDocument::Indented);
+void printMethodsJson(const LogosModule& plugin) {
+    printJsonText(plugin.methodsJsonText());
 }
 
 void printEventsHuman(const QJsonArray& events) {
@@ -258,28 +391,171 @@ void printEventsHuman(const QJsonArray& events) {
     }
 }
 
-void printEventsJson(QObject* plugin) {
-    QJsonArray eventsArray = LogosModule::getEventsAsJson(plugin);
-    QJsonDocument doc(eventsArray);
-    out << doc.toJson(QJsonDocument::Indented);
+void printEventsJson(const LogosModule& plugin) {
+    printJsonText(plugin.eventsJsonText());
 }
 
-int cmdMetadata(const QString& pluginPath, bool jsonOutput) {
-    QFileInfo fileInfo(pluginPath);
-    QString absolutePath = fileInfo.absoluteFilePath();
+// Print methods or events from an interface sidecar, in the same form as
+// from a loaded plugin
+void printSidecarMethods(const InterfaceSidecar& sidecar, OutputMode mode) {
+    if (mode == OutputMode::Ndjson) {
+        printNdjsonRecords(sidecar.methods());
+    } else if (mode == OutputMode::Json) {
+        out << QJsonDocument(sidecar.methods()).toJson();
+    } else {
+        std::vector<MethodInfo> methods;
+        for (const QJsonValue& method : sidecar.methods()) {
+            methods.push_back(MethodInfo::fromJson(method.toObject()));
+        }
+        printMethodsHuman(methods);
+    }
+}
+
+void printSidecarEvents(const InterfaceSidecar& sidecar, OutputMode mode) {
+    if (mode == OutputMode::Ndjson) {
+        printNdjsonRecords(sidecar.events());
+    } else if (mode == OutputMode::Json) {
+        out << QJsonDocument(sidecar.events()).toJson();
+    } else {
+        printEventsHuman(sidecar.events());
+    }
+}
+
+// The --timings breakdown, on stderr so it never mixes with JSON output
+void printTimings(const LoadStats& stats) {
+    auto phase = [](const char* label, qint64 ns) {
+        err << "  " << QString::fromLatin1(label).leftJustified(24)
+            << (ns < 0 ? QStringLiteral("-") : QString::number(ns / 1e6, 'f', 3) + " ms") << "\n";
+    };
+    err << "Timings:\n";
+    phase("metadata read", stats.metadataReadNs);
+    phase("library load (dlopen)", stats.libraryLoadNs);
+    phase("plugin constructor", stats.instanceNs);
+    phase("createProviderObject", stats.providerCreateNs);
+    phase("interface description", stats.interfaceNs);
+    phase("methods JSON", stats.methodsJsonNs);
+    phase("total load", stats.loadNs());
+    err << "  " << QString("file size").leftJustified(24) << stats.fileSize << " bytes\n"
+        << "  " << QString("metadata size").leftJustified(24) << stats.metadataBytes << " bytes\n"
+        << "  " << QString("methods / events").leftJustified(24)
+        << stats.methodCount << " / " << stats.eventCount << Qt::endl;
+}
+
+// The --memory report, on stderr like --timings
+void printMemory(const MemoryStats& stats) {
+    auto bytes = [](qint64 value) {
+        return value < 0 ? QStringLiteral("-") : QString::number(value / 1024.0, 'f', 1) + " KiB";
+    };
+    err << "Memory:\n"
+        << "  " << QString("mapped by load").leftJustified(24) << bytes(stats.mappedBytes) << "\n";
+    for (const SharedObjectInfo& object : stats.newObjects) {
+        err << "    " << QString::fromStdString(object.path) << "  "
+            << bytes(static_cast<qint64>(object.mappedBytes)) << "\n";
+    }
+    err << "  " << QString("RSS delta").leftJustified(24)
+        << (stats.rssDeltaBytes == -1 ? QStringLiteral("-") : QString::number(stats.rssDeltaBytes / 1024.0, 'f', 1) + " KiB") << "\n"
+        << "  " << QString("cached interface").leftJustified(24) << bytes(stats.interfaceBytes) << "\n"
+        << "  " << QString("shared interface").leftJustified(24) << bytes(stats.sharedInterfaceBytes) << "\n"
+        << "  " << QString("metadata").leftJustified(24) << bytes(stats.metadataBytes) << Qt::endl;
+}
+
+// Load a plugin, discarding anything its constructor prints unless debug
+// output was requested.
+LogosModule loadPluginQuietly(const QString& absolutePath, bool debugOutput, QString* errorString) {
+    LoadOptions options;
+    options.output = debugOutput ? LoadOptions::Inherit : LoadOptions::Discard;
+    return LogosModule::loadFromPath(absolutePath, options, errorString);
+}
+
+// Everything one lm command learns about a plugin, gathered at most once:
+// the file is checked once, the plugin is loaded once, and once loaded its
+// metadata is the loader's own parse rather than a second read of the file.
+class InspectionSession {
+public:
+    InspectionSession(const QString& pluginPath, bool debugOutput)
+        : m_fileInfo(pluginPath)
+        , m_absolutePath(m_fileInfo.absoluteFilePath())
+        , m_debugOutput(debugOutput)
+    {
+    }
+
+    bool exists() const { return m_fileInfo.exists(); }
+    const QString& absolutePath() const { return m_absolutePath; }
+
+    // The loaded plugin; check isValid() and loadError() on failure
+    const LogosModule& plugin() {
+        if (!m_loaded) {
+            m_loaded = true;
+            m_plugin = loadPluginQuietly(m_absolutePath, m_debugOutput, &m_loadError);
+        }
+        return m_plugin;
+    }
+
+    const QString& loadError() const { return m_loadError; }
+
+    // The plugin's interface sidecar, if it has one matching the binary:
+    // methods and events can then be shown without loading the plugin.
+    // Not consulted with --timings / --memory, which measure the load itself.
+    const std::optional<InterfaceSidecar>& interfaceSidecar() {
+        if (!m_sidecarResolved) {
+            m_sidecarResolved = true;
+            if (!g_printTimings && !g_printMemory) {
+                m_sidecar = InterfaceSidecar::read(m_absolutePath);
+            }
+        }
+        return m_sidecar;
+    }
+
+    // The plugin's metadata: from the loader if the plugin has been loaded
+    // (even unsuccessfully, the loader may have parsed it), else read
+    // without loading.
+    const std::optional<ModuleMetadata>& metadata() {
+        if (!m_metadataResolved) {
+            m_metadataResolved = true;
+            if (m_loaded && m_plugin.metadata().isValid()) {
+                m_metadata = m_plugin.metadata();
+            } else {
+                m_metadata = LogosModule::extractMetadata(m_absolutePath);
+            }
+        }
+        return m_metadata;
+    }
+
+private:
+    QFileInfo m_fileInfo;
+    QString m_absolutePath;
+    bool m_debugOutput;
+
+    bool m_loaded = false;
+    LogosModule m_plugin;
+    QString m_loadError;
+
+    bool m_metadataResolved = false;
+    std::optional<ModuleMetadata> m_metadata;
+
+    bool m_sidecarResolved = false;
+    std::optional<InterfaceSidecar> m_sidecar;
+};
+
+int cmdMetadata(const QString& pluginPath, OutputMode mode) {
+    InspectionSession session(pluginPath, false);
     
-    if (!fileInfo.exists()) {
+    if (!session.exists()) {
         err << "Error: Plugin file not found: " << pluginPath << Qt::endl;
         return 1;
     }
     
-    auto metadata = LogosModule::extractMetadata(absolutePath);
+    const auto& metadata = session.metadata();
     if (!metadata) {
         err << "Error: Failed to extract metadata from: " << pluginPath << Qt::endl;
         return 1;
     }
     
-    if (jsonOutput) {
+    if (mode == OutputMode::Ndjson) {
+        printNdjsonRecord([&](JsonWriter& writer) {
+            writeMetadataJson(writer, *metadata, /*withProtocolVersion=*/true);
+        });
+    } else if (mode == OutputMode::Json) {
         printMetadataJson(*metadata);
     } else {
         printMetadataHuman(*metadata);
@@ -288,209 +564,746 @@ int cmdMetadata(const QString& pluginPath, bool jsonOutput) {
     return 0;
 }
 
-int cmdMethods(const QString& pluginPath, bool jsonOutput, bool debugOutput) {
-    QFileInfo fileInfo(pluginPath);
-    QString absolutePath = fileInfo.absoluteFilePath();
+// Load the session's plugin, reporting failure on stderr
+const LogosModule* loadSessionPlugin(InspectionSession& session) {
+    const LogosModule& plugin = session.plugin();
+    if (!plugin.isValid()) {
+        err << "Error: Failed to load plugin: " << session.loadError() << Qt::endl;
+        return nullptr;
+    }
+    return &plugin;
+}
+
+int cmdMethods(const QString& pluginPath, OutputMode mode, bool debugOutput) {
+    InspectionSession session(pluginPath, debugOutput);
     
-    if (!fileInfo.exists()) {
+    if (!session.exists()) {
         err << "Error: Plugin file not found: " << pluginPath << Qt::endl;
         return 1;
     }
     
-    QString errorString;
-    LogosModule plugin;
-    
-    if (!debugOutput) {
-        // Redirect stdout and stderr to /dev/null during plugin loading
-        int stdout_copy = dup(STDOUT_FILENO);
-        int stderr_copy = dup(STDERR_FILENO);
-        
-        int devnull = open("/dev/null", O_WRONLY);
-        if (devnull != -1) {
-            dup2(devnull, STDOUT_FILENO);
-            dup2(devnull, STDERR_FILENO);
-            close(devnull);
-        }
-        
-        // Load the plugin (this may trigger constructor output)
-        plugin = LogosModule::loadFromPath(absolutePath, &errorString);
-        
-        // Restore stdout and stderr
-        if (stdout_copy != -1) {
-            dup2(stdout_copy, STDOUT_FILENO);
-            close(stdout_copy);
-        }
-        if (stderr_copy != -1) {
-            dup2(stderr_copy, STDERR_FILENO);
-            close(stderr_copy);
-        }
-    } else {
-        // Debug mode: load normally without suppression
-        plugin = LogosModule::loadFromPath(absolutePath, &errorString);
-    }
-    
-    if (!plugin.isValid()) {
-        err << "Error: Failed to load plugin: " << errorString << Qt::endl;
-        return 1;
+    if (const auto& sidecar = session.interfaceSidecar()) {
+        printSidecarMethods(*sidecar, mode);
+        return 0;
     }
     
-    if (!plugin.instance()) {
-        err << "Error: Plugin loaded but instance is null" << Qt::endl;
+    const LogosModule* plugin = loadSessionPlugin(session);
+    if (!plugin) {
         return 1;
     }
     
-    if (jsonOutput) {
-        printMethodsJson(plugin.instance());
+    if (mode == OutputMode::Ndjson) {
+        // One record per method
+        printNdjsonRecords(plugin->getMethodsAsJson());
+    } else if (mode == OutputMode::Json) {
+        printMethodsJson(*plugin);
     } else {
-        auto methods = plugin.getMethods();
-        printMethodsHuman(methods);
+        printMethodsHuman(plugin->getMethods());
     }
 
+    if (g_printTimings) {
+        printTimings(plugin->loadStats());
+    }
+    if (g_printMemory) {
+        printMemory(plugin->memoryStats());
+    }
     return 0;
 }
 
-int cmdEvents(const QString& pluginPath, bool jsonOutput, bool debugOutput) {
-    QFileInfo fileInfo(pluginPath);
-    QString absolutePath = fileInfo.absoluteFilePath();
+int cmdEvents(const QString& pluginPath, OutputMode mode, bool debugOutput) {
+    InspectionSession session(pluginPath, debugOutput);
 
-    if (!fileInfo.exists()) {
+    if (!session.exists()) {
         err << "Error: Plugin file not found: " << pluginPath << Qt::endl;
         return 1;
     }
 
-    QString errorString;
-    LogosModule plugin;
-
-    if (!debugOutput) {
-        int stdout_copy = dup(STDOUT_FILENO);
-        int stderr_copy = dup(STDERR_FILENO);
-        int devnull = open("/dev/null", O_WRONLY);
-        if (devnull != -1) {
-            dup2(devnull, STDOUT_FILENO);
-            dup2(devnull, STDERR_FILENO);
-            close(devnull);
-        }
-        plugin = LogosModule::loadFromPath(absolutePath, &errorString);
-        if (stdout_copy != -1) { dup2(stdout_copy, STDOUT_FILENO); close(stdout_copy); }
-        if (stderr_copy != -1) { dup2(stderr_copy, STDERR_FILENO); close(stderr_copy); }
-    } else {
-        plugin = LogosModule::loadFromPath(absolutePath, &errorString);
+    if (const auto& sidecar = session.interfaceSidecar()) {
+        printSidecarEvents(*sidecar, mode);
+        return 0;
     }
 
-    if (!plugin.isValid()) {
-        err << "Error: Failed to load plugin: " << errorString << Qt::endl;
-        return 1;
-    }
-    if (!plugin.instance()) {
-        err << "Error: Plugin loaded but instance is null" << Qt::endl;
+    const LogosModule* plugin = loadSessionPlugin(session);
+    if (!plugin) {
         return 1;
     }
 
-    if (jsonOutput) {
-        printEventsJson(plugin.instance());
+    if (mode == OutputMode::Ndjson) {
+        // One record per event
+        printNdjsonRecords(plugin->getEventsAsJson());
+    } else if (mode == OutputMode::Json) {
+        printEventsJson(*plugin);
     } else {
-        printEventsHuman(plugin.getEventsAsJson());
+        printEventsHuman(plugin->getEventsAsJson());
     }
 
+    if (g_printTimings) {
+        printTimings(plugin->loadStats());
+    }
+    if (g_printMemory) {
+        printMemory(plugin->memoryStats());
+    }
     return 0;
 }
 
-int cmdInfo(const QString& pluginPath, bool jsonOutput, bool debugOutput) {
-    QFileInfo fileInfo(pluginPath);
-    QString absolutePath = fileInfo.absoluteFilePath();
+// Run as IsolatedIntrospection's helper: the reply echoes the protocol it asked for
+void writeHelperProtocol(JsonWriter& writer) {
+    using namespace IsolatedIntrospection;
+    if (qEnvironmentVariableIntValue(HelperProtocolVariable) == HelperProtocolVersion) {
+        writer.key("helperProtocol").value(static_cast<long long>(HelperProtocolVersion));
+    }
+}
+
+int cmdInfo(const QString& pluginPath, OutputMode mode, bool debugOutput) {
+    InspectionSession session(pluginPath, debugOutput);
     
-    if (!fileInfo.exists()) {
+    if (!session.exists()) {
         err << "Error: Plugin file not found: " << pluginPath << Qt::endl;
         return 1;
     }
     
-    if (jsonOutput) {
-        // For JSON output, combine metadata and methods into a single object
-        auto metadata = LogosModule::extractMetadata(absolutePath);
-        if (!metadata) {
-            err << "Error: Failed to extract metadata from: " << pluginPath << Qt::endl;
+    // A sidecar supplies methods and events without loading the plugin;
+    // otherwise one load serves all three sections and the metadata comes from it
+    const auto& sidecar = session.interfaceSidecar();
+    if (!sidecar) {
+        session.plugin();
+    }
+    const auto& metadata = session.metadata();
+    if (!metadata) {
+        err << "Error: Failed to extract metadata from: " << pluginPath << Qt::endl;
+        return 1;
+    }
+    
+    if (sidecar) {
+        if (mode == OutputMode::Human) {
+            printMetadataHuman(*metadata);
+            out << "\n";
+            printSidecarMethods(*sidecar, mode);
+            out << "\n";
+            printSidecarEvents(*sidecar, mode);
+            return 0;
+        }
+        auto write = [&](JsonWriter& writer) {
+            writer.beginObject();
+            writer.key("events").value(sidecar->events());
+            writeHelperProtocol(writer);
+            writer.key("metadata");
+            writeMetadataJson(writer, *metadata, /*withProtocolVersion=*/false);
+            writer.key("methods").value(sidecar->methods());
+            writer.endObject();
+        };
+        if (mode == OutputMode::Ndjson) {
+            printNdjsonRecord(write);
+        } else {
+            std::string text;
+            JsonWriter writer(text);
+            write(writer);
+            printJsonText(text);
+        }
+        return 0;
+    }
+    
+    if (mode == OutputMode::Ndjson) {
+        const LogosModule* plugin = loadSessionPlugin(session);
+        if (!plugin) {
             return 1;
         }
         
-        // Load plugin for methods
-        QString errorString;
-        LogosModule plugin;
-        
-        if (!debugOutput) {
-            // Suppress output during loading
-            int stdout_copy = dup(STDOUT_FILENO);
-            int stderr_copy = dup(STDERR_FILENO);
-            
-            int devnull = open("/dev/null", O_WRONLY);
-            if (devnull != -1) {
-                dup2(devnull, STDOUT_FILENO);
-                dup2(devnull, STDERR_FILENO);
-                close(devnull);
+        // One record for the module, built from the memoized compact text
+        printNdjsonRecord([&](JsonWriter& writer) {
+            writer.beginObject();
+            writer.key("events").rawValue(plugin->eventsJsonText(JsonFormat::Compact));
+            writeHelperProtocol(writer);
+            if (g_printMemory) {
+                writer.key("memory").value(plugin->memoryStats().toJson());
             }
-            
-            plugin = LogosModule::loadFromPath(absolutePath, &errorString);
-            
-            if (stdout_copy != -1) {
-                dup2(stdout_copy, STDOUT_FILENO);
-                close(stdout_copy);
+            writer.key("metadata");
+            writeMetadataJson(writer, *metadata, /*withProtocolVersion=*/false);
+            writer.key("methods").rawValue(plugin->methodsJsonText(JsonFormat::Compact));
+            if (g_printTimings) {
+                writer.key("timings").value(plugin->loadStats().toJson());
             }
-            if (stderr_copy != -1) {
-                dup2(stderr_copy, STDERR_FILENO);
-                close(stderr_copy);
-            }
-        } else {
-            plugin = LogosModule::loadFromPath(absolutePath, &errorString);
-        }
-        
-        if (!plugin.isValid()) {
-            err << "Error: Failed to load plugin: " << errorString << Qt::endl;
+            writer.endObject();
+        });
+    } else if (mode == OutputMode::Json) {
+        const LogosModule* plugin = loadSessionPlugin(session);
+        if (!plugin) {
             return 1;
         }
         
-        // Build combined JSON object
-        QJsonObject combined;
-        
-        QJsonObject metadataObj;
-        metadataObj["name"] = metadata->name;
-        if (!metadata->displayName.isEmpty())
-            metadataObj["display_name"] = metadata->displayName;
-        metadataObj["version"] = metadata->version;
-        metadataObj["description"] = metadata->description;
-        metadataObj["author"] = metadata->author;
-        metadataObj["type"] = metadata->type;
-        
-        QJsonArray deps;
-        for (const QString& dep : metadata->dependencies) {
-            deps.append(dep);
+        // Stream the combined object: events, metadata, methods
+        std::string text;
+        JsonWriter writer(text);
+        writer.beginObject();
+        writer.key("events");
+        plugin->writeEventsJson(writer);
+        writeHelperProtocol(writer);
+        if (g_printMemory) {
+            writer.key("memory").value(plugin->memoryStats().toJson());
         }
-        metadataObj["dependencies"] = deps;
-        
-        combined["metadata"] = metadataObj;
-        combined["methods"] = LogosModule::getMethodsAsJson(plugin.instance());
-        combined["events"] = LogosModule::getEventsAsJson(plugin.instance());
-
-        QJsonDocument doc(combined);
-        out << doc.toJson(QJsonDocument::Indented);
+        writer.key("metadata");
+        writeMetadataJson(writer, *metadata, /*withProtocolVersion=*/false);
+        writer.key("methods");
+        plugin->writeMethodsJson(writer);
+        if (g_printTimings) {
+            writer.key("timings").value(plugin->loadStats().toJson());
+        }
+        writer.endObject();
+        printJsonText(text);
     } else {
         // For human-readable output, print metadata, then methods, then events.
-        int result = cmdMetadata(pluginPath, false);
-        if (result != 0) {
-            return result;
-        }
+        printMetadataHuman(*metadata);
 
         out << "\n";
-        result = cmdMethods(pluginPath, false, debugOutput);
-        if (result != 0) {
-            return result;
+        const LogosModule* plugin = loadSessionPlugin(session);
+        if (!plugin) {
+            return 1;
         }
+        printMethodsHuman(plugin->getMethods());
 
         out << "\n";
-        return cmdEvents(pluginPath, false, debugOutput);
+        printEventsHuman(plugin->getEventsAsJson());
+        if (g_printTimings) {
+            printTimings(plugin->loadStats());
+        }
+        if (g_printMemory) {
+            printMemory(plugin->memoryStats());
+        }
+    }
+
+    return 0;
+}
+
+int cmdIndex(const QString& directory, OutputMode mode) {
+    QFileInfo dirInfo(directory);
+    if (!dirInfo.isDir()) {
+        err << "Error: Module directory not found: " << directory << Qt::endl;
+        return 1;
+    }
+
+    QString errorString;
+    int moduleCount = 0;
+    if (!MetadataIndex::build(dirInfo.absoluteFilePath(), &errorString, &moduleCount)) {
+        err << "Error: Failed to write index: " << errorString << Qt::endl;
+        return 1;
     }
 
+    const QString indexPath = MetadataIndex::indexPath(dirInfo.absoluteFilePath());
+    if (mode != OutputMode::Human) {
+        auto write = [&](JsonWriter& writer) {
+            writer.beginObject();
+            writer.key("directory").value(dirInfo.absoluteFilePath());
+            writer.key("index").value(indexPath);
+            writer.key("modules").value(moduleCount);
+            writer.endObject();
+        };
+        if (mode == OutputMode::Ndjson) {
+            printNdjsonRecord(write);
+        } else {
+            std::string text;
+            JsonWriter writer(text);
+            write(writer);
+            printJsonText(text);
+        }
+    } else {
+        out << "Indexed " << moduleCount << " module(s) into " << indexPath << "\n";
+    }
     return 0;
 }
 
+int cmdExportInterface(const QString& pluginPath, const QString& outputPath,
+                       OutputMode mode, bool debugOutput) {
+    InspectionSession session(pluginPath, debugOutput);
+
+    if (!session.exists()) {
+        err << "Error: Plugin file not found: " << pluginPath << Qt::endl;
+        return 1;
+    }
+
+    const LogosModule* plugin = loadSessionPlugin(session);
+    if (!plugin) {
+        return 1;
+    }
+
+    QString errorString;
+    if (!InterfaceSidecar::write(*plugin, session.absolutePath(), outputPath, &errorString)) {
+        err << "Error: Failed to write interface: " << errorString << Qt::endl;
+        return 1;
+    }
+
+    const QString sidecarPath = outputPath.isEmpty()
+        ? InterfaceSidecar::sidecarPath(session.absolutePath())
+        : outputPath;
+    const int methodCount = plugin->getMethodsAsJson().size();
+    const int eventCount = plugin->getEventsAsJson().size();
+    if (mode != OutputMode::Human) {
+        auto write = [&](JsonWriter& writer) {
+            writer.beginObject();
+            writer.key("events").value(eventCount);
+            writer.key("interface").value(sidecarPath);
+            writer.key("methods").value(methodCount);
+            writer.key("module").value(plugin->metadata().name);
+            writer.endObject();
+        };
+        if (mode == OutputMode::Ndjson) {
+            printNdjsonRecord(write);
+        } else {
+            std::string text;
+            JsonWriter writer(text);
+            write(writer);
+            printJsonText(text);
+        }
+    } else {
+        out << "Exported " << methodCount << " method(s) and " << eventCount
+            << " event(s) into " << sidecarPath << "\n";
+    }
+    return 0;
+}
+
+// =============================================================================
+// scan
+// =============================================================================
+
+struct ScanOptions {
+    QStringList inputs;
+    bool metadataOnly = false;
+    bool ndjson = false;
+    int jobs = 0;
+    int timeoutMs = 30000;
+    bool timings = false;
+    bool memory = false;
+};
+
+struct ScanRecord {
+    QString path;
+    bool ok = false;
+    QJsonObject info;                        // worker output (load mode)
+    std::optional<ModuleMetadata> metadata;  // metadata-only mode
+    QString error;
+};
+
+// Expand directories (their plugin files), globs and plain paths into a
+// deduplicated list of absolute plugin paths, in input order.
+bool expandScanInputs(const QStringList& inputs, QStringList* paths) {
+    QSet<QString> seen;
+    auto add = [&](const QFileInfo& info) {
+        const QString path = info.absoluteFilePath();
+        if (!seen.contains(path)) {
+            seen.insert(path);
+            paths->append(path);
+        }
+    };
+
+    for (const QString& input : inputs) {
+        const QFileInfo info(input);
+        if (info.isDir()) {
+            const QFileInfoList entries = QDir(input).entryInfoList(QDir::Files, QDir::Name);
+            for (const QFileInfo& entry : entries) {
+                if (QLibrary::isLibrary(entry.fileName())) {
+                    add(entry);
+                }
+            }
+        } else if (info.isFile()) {
+            add(info);
+        } else if (input.contains(QRegularExpression(QStringLiteral("[*?\\[]")))) {
+            const QFileInfoList entries = QDir(info.path()).entryInfoList(
+                QStringList{info.fileName()}, QDir::Files, QDir::Name);
+            for (const QFileInfo& entry : entries) {
+                add(entry);
+            }
+        } else {
+            err << "Error: No such file or directory: " << input << Qt::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+void writeScanRecord(JsonWriter& writer, const ScanRecord& record) {
+    writer.beginObject();
+    writer.key("path").value(record.path);
+    writer.key("ok").value(record.ok);
+    if (!record.ok) {
+        writer.key("error").value(record.error);
+    } else if (record.metadata) {
+        writer.key("metadata");
+        writeMetadataJson(writer, *record.metadata, /*withProtocolVersion=*/true);
+    } else {
+        writer.key("info").value(record.info);
+    }
+    writer.endObject();
+}
+
+void printScanRecordLine(const ScanRecord& record) {
+    printNdjsonRecord([&](JsonWriter& writer) { writeScanRecord(writer, record); });
+}
+
+// Inspect each plugin in a worker process (`lm <path> --json`), at most
+// `jobs` at a time, killing workers that exceed the timeout.
+void runScanWorkers(const QStringList& paths, const ScanOptions& options,
+                    std::vector<ScanRecord>& records) {
+    const QString program = QCoreApplication::applicationFilePath();
+    QEventLoop loop;
+    int next = 0;
+    int running = 0;
+
+    std::function<void()> startWorkers;
+    auto finish = [&](int index, QProcess* process, bool timedOut) {
+        ScanRecord& record = records[static_cast<size_t>(index)];
+        const QByteArray output = process->readAllStandardOutput();
+        const QString errorOutput = QString::fromLocal8Bit(process->readAllStandardError()).trimmed();
+
+        if (timedOut) {
+            record.error = QStringLiteral("Timed out after %1 s").arg(options.timeoutMs / 1000.0);
+        } else if (process->error() == QProcess::FailedToStart) {
+            record.error = QStringLiteral("Failed to start worker: ") + process->errorString();
+        } else if (process->exitStatus() == QProcess::CrashExit) {
+            record.error = QStringLiteral("Worker crashed");
+            if (!errorOutput.isEmpty()) {
+                record.error += QStringLiteral(": ") + errorOutput;
+            }
+        } else if (process->exitCode() != 0) {
+            record.error = errorOutput.isEmpty()
+                ? QStringLiteral("Worker exited with code %1").arg(process->exitCode())
+                : errorOutput;
+        } else {
+            QJsonParseError parseError;
+            const QJsonDocument doc = QJsonDocument::fromJson(output, &parseError);
+            if (doc.isObject()) {
+                record.ok = true;
+                record.info = doc.object();
+            } else {
+                record.error = QStringLiteral("Invalid worker output: ") + parseError.errorString();
+            }
+        }
+
+        if (options.ndjson) {
+            printScanRecordLine(record);
+        }
+        process->deleteLater();
+        --running;
+        startWorkers();
+        if (running == 0) {
+            loop.quit();
+        }
+    };
+
+    startWorkers = [&]() {
+        while (running < options.jobs && next < paths.size()) {
+            const int index = next++;
+            ++running;
+
+            auto* process = new QProcess(&loop);
+            auto* timer = new QTimer(process);
+            auto timedOut = std::make_shared<bool>(false);
+            auto done = std::make_shared<bool>(false);
+            auto complete = [&finish, index, process, timer, timedOut, done]() {
+                if (*done) {
+                    return;
+                }
+                *done = true;
+                timer->stop();
+                finish(index, process, *timedOut);
+            };
+
+            timer->setSingleShot(true);
+            QObject::connect(timer, &QTimer::timeout, process, [process, timedOut]() {
+                *timedOut = true;
+                process->kill();
+            });
+            QObject::connect(process, &QProcess::finished, process, complete);
+            QObject::connect(process, &QProcess::errorOccurred, process,
+                             [complete](QProcess::ProcessError error) {
+                                 // finished() is never emitted for a worker that did not start
+                                 if (error == QProcess::FailedToStart) {
+                                     complete();
+                                 }
+                             });
+
+            timer->start(options.timeoutMs);
+            QStringList workerArgs{paths[index], QStringLiteral("--json")};
+            if (options.timings) {
+                workerArgs.append(QStringLiteral("--timings"));
+            }
+            if (options.memory) {
+                workerArgs.append(QStringLiteral("--memory"));
+            }
+            process->start(program, workerArgs);
+        }
+    };
+
+    startWorkers();
+    if (running > 0) {
+        loop.exec();
+    }
+}
+
+int cmdScan(const ScanOptions& options) {
+    QStringList paths;
+    if (!expandScanInputs(options.inputs, &paths)) {
+        return 1;
+    }
+
+    std::vector<ScanRecord> records(static_cast<size_t>(paths.size()));
+    for (int i = 0; i < paths.size(); ++i) {
+        records[static_cast<size_t>(i)].path = paths[i];
+    }
+
+    if (options.metadataOnly) {
+        std::vector<std::string> stdPaths;
+        stdPaths.reserve(records.size());
+        for (const QString& path : paths) {
+            stdPaths.push_back(path.toStdString());
+        }
+        const std::vector<MetadataResult> results =
+            ModuleMetadata::fromPaths(stdPaths, static_cast<unsigned>(options.jobs));
+        for (size_t i = 0; i < results.size(); ++i) {
+            records[i].ok = results[i].ok();
+            records[i].metadata = results[i].metadata;
+            records[i].error = QString::fromStdString(results[i].error);
+            if (options.ndjson) {
+                printScanRecordLine(records[i]);
+            }
+        }
+    } else {
+        runScanWorkers(paths, options, records);
+    }
+
+    if (!options.ndjson) {
+        std::string text;
+        JsonWriter writer(text);
+        writer.beginArray();
+        for (const ScanRecord& record : records) {
+            writeScanRecord(writer, record);
+        }
+        writer.endArray();
+        printJsonText(text);
+    }
+
+    for (const ScanRecord& record : records) {
+        if (!record.ok) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Parse `lm scan` arguments; returns false (after reporting) on bad input
+bool parseScanArgs(const std::vector<std::string>& args, ScanOptions* options, bool* helpShown) {
+    for (size_t i = 1; i < args.size(); ++i) {
+        const std::string& arg = args[i];
+        auto needValue = [&](int* value, int scale) {
+            bool ok = false;
+            const int parsed = (i + 1 < args.size())
+                ? QString::fromStdString(args[i + 1]).toInt(&ok) : 0;
+            if (!ok || parsed <= 0) {
+                err << "Error: " << QString::fromStdString(arg)
+                    << " expects a positive number" << Qt::endl;
+                return false;
+            }
+            *value = parsed * scale;
+            ++i;
+            return true;
+        };
+
+        if (arg == "--help" || arg == "-h") {
+            printCommandHelp("scan");
+            *helpShown = true;
+            return true;
+        } else if (arg == "--metadata-only") {
+            options->metadataOnly = true;
+        } else if (arg == "--timings") {
+            options->timings = true;
+        } else if (arg == "--memory") {
+            options->memory = true;
+        } else if (arg == "--ndjson") {
+            options->ndjson = true;
+        } else if (arg == "--json") {
+            // JSON is scan's only output; accepted for symmetry
+        } else if (arg == "--debug") {
+            g_debugMode = true;
+        } else if (arg == "--jobs" || arg == "-j") {
+            if (!needValue(&options->jobs, 1)) return false;
+        } else if (arg == "--timeout") {
+            if (!needValue(&options->timeoutMs, 1000)) return false;
+        } else if (!arg.empty() && arg[0] == '-') {
+            err << "Error: Unknown option '" << QString::fromStdString(arg) << "'" << Qt::endl;
+            return false;
+        } else {
+            options->inputs.append(QString::fromStdString(arg));
+        }
+    }
+
+    if (options->inputs.isEmpty()) {
+        err << "Error: Missing directory, glob or plugin path" << Qt::endl;
+        err << "\nUsage: lm scan [options] <dir|glob|plugin-path>..." << Qt::endl;
+        return false;
+    }
+    if (options->jobs <= 0) {
+        options->jobs = std::max(1, QThread::idealThreadCount());
+    }
+    return true;
+}
+
+// =============================================================================
+// serve
+// =============================================================================
+
+// Long-lived request loop behind `lm serve`. Each plugin path keeps an
+// InspectionSession (loaded plugin, metadata, memoized interface text)
+// stamped with the file's identity; a changed file gets a fresh session.
+class ServeLoop {
+public:
+    int run() {
+        // Metadata reads stay warm across requests, keyed by file identity
+        MetadataCache::global().setEnabled(true);
+
+        QTextStream in(stdin);
+        QString line;
+        while (in.readLineInto(&line)) {
+            if (line.trimmed().isEmpty()) {
+                continue;
+            }
+            std::string response;
+            const bool keepGoing = handle(line.toUtf8(), response);
+            response += '\n';
+            printJsonText(response);
+            out.flush();
+            if (!keepGoing) {
+                break;
+            }
+        }
+        return 0;
+    }
+
+private:
+    struct Module {
+        FileIdentity identity;
+        std::unique_ptr<InspectionSession> session;
+    };
+
+    // Returns false once a shutdown request has been answered
+    bool handle(const QByteArray& request, std::string& response) {
+        JsonWriter writer(response, JsonFormat::Compact);
+
+        QJsonParseError parseError;
+        const QJsonDocument doc = QJsonDocument::fromJson(request, &parseError);
+        if (!doc.isObject()) {
+            writeError(writer, QJsonValue(), QStringLiteral("Invalid request: ") +
+                       (parseError.error != QJsonParseError::NoError
+                            ? parseError.errorString()
+                            : QStringLiteral("expected a JSON object")));
+            return true;
+        }
+
+        const QJsonObject obj = doc.object();
+        const QJsonValue id = obj.value(QStringLiteral("id"));
+        const QString command = obj.value(QStringLiteral("command")).toString();
+        const QString path = obj.value(QStringLiteral("path")).toString();
+
+        if (command == QLatin1String("shutdown")) {
+            beginResult(writer, id).value(true);
+            writer.endObject();
+            return false;
+        }
+        if (command != QLatin1String("metadata") && command != QLatin1String("methods") &&
+            command != QLatin1String("events") && command != QLatin1String("info")) {
+            writeError(writer, id, QStringLiteral("Unknown command: ") + command);
+            return true;
+        }
+        if (path.isEmpty()) {
+            writeError(writer, id, QStringLiteral("Missing plugin path"));
+            return true;
+        }
+
+        QString error;
+        InspectionSession* session = sessionFor(path, &error);
+        if (!session) {
+            writeError(writer, id, error);
+            return true;
+        }
+
+        if (command == QLatin1String("metadata")) {
+            const auto& metadata = session->metadata();
+            if (!metadata) {
+                writeError(writer, id, QStringLiteral("Failed to extract metadata from: ") + path);
+                return true;
+            }
+            writeMetadataJson(beginResult(writer, id), *metadata, /*withProtocolVersion=*/true);
+            writer.endObject();
+            return true;
+        }
+
+        const LogosModule& plugin = session->plugin();
+        if (!plugin.isValid()) {
+            writeError(writer, id, QStringLiteral("Failed to load plugin: ") + session->loadError());
+            return true;
+        }
+
+        if (command == QLatin1String("methods")) {
+            beginResult(writer, id).rawValue(plugin.methodsJsonText(JsonFormat::Compact));
+        } else if (command == QLatin1String("events")) {
+            beginResult(writer, id).rawValue(plugin.eventsJsonText(JsonFormat::Compact));
+        } else {
+            const auto& metadata = session->metadata();
+            if (!metadata) {
+                writeError(writer, id, QStringLiteral("Failed to extract metadata from: ") + path);
+                return true;
+            }
+            beginResult(writer, id).beginObject();
+            writer.key("events").rawValue(plugin.eventsJsonText(JsonFormat::Compact));
+            writer.key("metadata");
+            writeMetadataJson(writer, *metadata, /*withProtocolVersion=*/false);
+            writer.key("methods").rawValue(plugin.methodsJsonText(JsonFormat::Compact));
+            writer.endObject();
+        }
+        writer.endObject();
+        return true;
+    }
+
+    // The warm session for a plugin file, replaced when the file changed
+    InspectionSession* sessionFor(const QString& path, QString* error) {
+        const QFileInfo info(path);
+        const std::string key = info.absoluteFilePath().toStdString();
+        const std::optional<FileIdentity> identity = FileIdentity::of(key);
+        if (!identity || !info.isFile()) {
+            m_modules.erase(key);
+            *error = QStringLiteral("Plugin file not found: ") + path;
+            return nullptr;
+        }
+
+        auto it = m_modules.find(key);
+        if (it != m_modules.end() && it->second.identity != *identity) {
+            // Unload the old build before the new one is loaded
+            m_modules.erase(it);
+            it = m_modules.end();
+        }
+        if (it == m_modules.end()) {
+            Module module{*identity, std::make_unique<InspectionSession>(
+                QString::fromStdString(key), /*debugOutput=*/false)};
+            it = m_modules.emplace(key, std::move(module)).first;
+        }
+        return it->second.session.get();
+    }
+
+    static JsonWriter& beginResult(JsonWriter& writer, const QJsonValue& id) {
+        writer.beginObject();
+        writer.key("id").value(id);
+        writer.key("ok").value(true);
+        return writer.key("result");
+    }
+
+    static void writeError(JsonWriter& writer, const QJsonValue& id, const QString& error) {
+        writer.beginObject();
+        writer.key("id").value(id);
+        writer.key("ok").value(false);
+        writer.key("error").value(error);
+        writer.endObject();
+    }
+
+    std::unordered_map<std::string, Module> m_modules;
+};
+
 int main(int argc, char* argv[]) {
     QCoreApplication app(argc, argv);
     
@@ -519,14 +1332,41 @@ int main(int argc, char* argv[]) {
         return 0;
     }
     
+    if (firstArg == "serve") {
+        for (size_t i = 1; i < args.size(); ++i) {
+            if (args[i] == "--help" || args[i] == "-h") {
+                printCommandHelp("serve");
+                return 0;
+            } else if (args[i] == "--debug") {
+                g_debugMode = true;
+            } else {
+                err << "Error: Unknown option '" << QString::fromStdString(args[i]) << "'" << Qt::endl;
+                return 1;
+            }
+        }
+        ServeLoop loop;
+        return loop.run();
+    }
+    
+    if (firstArg == "scan") {
+        ScanOptions options;
+        bool helpShown = false;
+        if (!parseScanArgs(args, &options, &helpShown)) {
+            return 1;
+        }
+        return helpShown ? 0 : cmdScan(options);
+    }
+    
     std::string command;
     bool defaultMode = false;
-    bool jsonOutput = false;
+    OutputMode mode = OutputMode::Human;
     bool debugOutput = false;
     QString pluginPath;
+    QString outputPath;
     
     // Check if first arg is a command or a plugin path
-    if (firstArg == "metadata" || firstArg == "methods" || firstArg == "events") {
+    if (firstArg == "metadata" || firstArg == "methods" || firstArg == "events"
+        || firstArg == "index" || firstArg == "export-interface") {
         command = firstArg;
     } else if (firstArg[0] != '-') {
         // First arg is not a command and not an option, treat as plugin path
@@ -550,9 +1390,24 @@ int main(int argc, char* argv[]) {
             }
             return 0;
         } else if (arg == "--json") {
-            jsonOutput = true;
+            if (mode != OutputMode::Ndjson) {
+                mode = OutputMode::Json;
+            }
+        } else if (arg == "--ndjson") {
+            mode = OutputMode::Ndjson;
         } else if (arg == "--debug") {
             debugOutput = true;
+        } else if (arg == "--timings") {
+            g_printTimings = true;
+        } else if (arg == "--memory") {
+            g_printMemory = true;
+            LogosModule::setMemoryTracking(true);
+        } else if ((arg == "--output" || arg == "-o") && command == "export-interface") {
+            if (i + 1 >= args.size()) {
+                err << "Error: " << QString::fromStdString(arg) << " requires a file" << Qt::endl;
+                return 1;
+            }
+            outputPath = QString::fromStdString(args[++i]);
         } else if (arg[0] == '-') {
             err << "Error: Unknown option '" << QString::fromStdString(arg) << "'" << Qt::endl;
             return 1;
@@ -566,6 +1421,12 @@ int main(int argc, char* argv[]) {
         }
     }
     
+    if (pluginPath.isEmpty() && command == "index") {
+        err << "Error: Missing module directory" << Qt::endl;
+        err << "\nUsage: lm index [options] <module-dir>" << Qt::endl;
+        return 1;
+    }
+
     if (pluginPath.isEmpty()) {
         err << "Error: Missing plugin path" << Qt::endl;
         if (defaultMode) {
@@ -580,13 +1441,17 @@ int main(int argc, char* argv[]) {
     g_debugMode = debugOutput;
     
     if (defaultMode) {
-        return cmdInfo(pluginPath, jsonOutput, debugOutput);
+        return cmdInfo(pluginPath, mode, debugOutput);
     } else if (command == "metadata") {
-        return cmdMetadata(pluginPath, jsonOutput);
+        return cmdMetadata(pluginPath, mode);
     } else if (command == "methods") {
-        return cmdMethods(pluginPath, jsonOutput, debugOutput);
+        return cmdMethods(pluginPath, mode, debugOutput);
     } else if (command == "events") {
-        return cmdEvents(pluginPath, jsonOutput, debugOutput);
+        return cmdEvents(pluginPath, mode, debugOutput);
+    } else if (command == "index") {
+        return cmdIndex(pluginPath, mode);
+    } else if (command == "export-interface") {
+        return cmdExportInterface(pluginPath, outputPath, mode, debugOutput);
     }
 
     return 0;
@@ -0,0 +1,32 @@
+#include "file_identity.h"
+#include <sys/stat.h>
+
+namespace ModuleLib {
+
+std::optional<FileIdentity> FileIdentity::of(const std::string& path) {
+    if (path.empty()) {
+        return std::nullopt;
+    }
+
+    struct stat st;
+    if (::stat(path.c_str(), &st) != 0) {
+        return std::nullopt;
+    }
+
+    FileIdentity identity;
+#if defined(__APPLE__)
+    identity.mtimeNs = static_cast<std::int64_t>(st.st_mtimespec.tv_sec) * 1000000000
+                     + st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+    identity.mtimeNs = static_cast<std::int64_t>(st.st_mtime) * 1000000000;
+#else
+    identity.mtimeNs = static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000
+                     + st.st_mtim.tv_nsec;
+#endif
+    identity.size = static_cast<std::int64_t>(st.st_size);
+    identity.inode = static_cast<std::uint64_t>(st.st_ino);
+    identity.device = static_cast<std::uint64_t>(st.st_dev);
+    return identity;
+}
+
+} // namespace ModuleLib
@@ -0,0 +1,41 @@
+#ifndef FILE_IDENTITY_H
+#define FILE_IDENTITY_H
+
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace ModuleLib {
+
+/**
+ * @brief FileIdentity is the stat() key used to tell whether a file changed.
+ *
+ * Two identities compare equal when the file has the same modification time,
+ * size, inode and device — i.e. it has not been rewritten or replaced since
+ * the identity was taken. Caches of anything derived from a plugin file
+ * (metadata, interface descriptions) key their entries on it.
+ */
+struct FileIdentity {
+    std::int64_t mtimeNs = 0;
+    std::int64_t size = 0;
+    std::uint64_t inode = 0;
+    std::uint64_t device = 0;
+
+    bool operator==(const FileIdentity& other) const {
+        return mtimeNs == other.mtimeNs && size == other.size
+            && inode == other.inode && device == other.device;
+    }
+    bool operator!=(const FileIdentity& other) const { return !(*this == other); }
+
+    /**
+     * @brief stat() a file and return its identity.
+     *
+     * @param path Path to the file
+     * @return std::optional<FileIdentity> The identity, or std::nullopt if the file cannot be stat'ed
+     */
+    static std::optional<FileIdentity> of(const std::string& path);
+};
+
+} // namespace ModuleLib
+
+#endif // FILE_IDENTITY_H
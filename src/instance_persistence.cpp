@@ -1,9 +1,18 @@
 #include "instance_persistence.h"
 
+#include <QDateTime>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
+#include <QHash>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <QSet>
 #include <QUuid>
 #include <QDebug>
+#include <algorithm>
+#include <optional>
 
 namespace ModuleLib {
 namespace InstancePersistence {
@@ -25,12 +34,227 @@ static bool isValidPathSegment(const QString& name)
     return true;
 }
 
-InstanceInfo resolveInstance(const QString& basePath,
-                             const QString& moduleName,
-                             ResolveMode mode,
-                             const QString& explicitInstanceId)
+namespace {
+
+qint64 nowMs()
 {
-    if (basePath.isEmpty() || moduleName.isEmpty()) {
+    return QDateTime::currentMSecsSinceEpoch();
+}
+
+QString registryPath(const QString& modulePath)
+{
+    return modulePath + "/" + QString::fromLatin1(RegistryFileName);
+}
+
+/// A module's instance registry, as stored in {modulePath}/RegistryFileName
+struct Registry {
+    QHash<QString, InstanceRecord> records;
+    QString mostRecent;
+    bool dirty = false;
+
+    /// Record a use of an instance, registering it if it is new. Reusing the
+    /// most recent instance only moves its lastUsed time, which is not worth
+    /// a write more than once per LastUsedGranularityMs.
+    void touch(const QString& instanceId, qint64 now)
+    {
+        auto it = records.find(instanceId);
+        if (it == records.end()) {
+            it = records.insert(instanceId, InstanceRecord{instanceId, now, now});
+        } else if (instanceId == mostRecent && now - it->lastUsedMs < LastUsedGranularityMs) {
+            return;
+        }
+        it->lastUsedMs = now;
+        mostRecent = instanceId;
+        dirty = true;
+    }
+
+    void remove(const QString& instanceId)
+    {
+        records.remove(instanceId);
+        if (mostRecent == instanceId) {
+            mostRecent.clear();
+            const std::vector<InstanceRecord> remaining = sorted();
+            if (!remaining.empty()) {
+                mostRecent = remaining.front().instanceId;
+            }
+        }
+        dirty = true;
+    }
+
+    /// Records, most recently used first (ties broken by ID)
+    std::vector<InstanceRecord> sorted() const
+    {
+        std::vector<InstanceRecord> list(records.cbegin(), records.cend());
+        std::sort(list.begin(), list.end(), [this](const InstanceRecord& a, const InstanceRecord& b) {
+            if ((a.instanceId == mostRecent) != (b.instanceId == mostRecent))
+                return a.instanceId == mostRecent;
+            if (a.lastUsedMs != b.lastUsedMs)
+                return a.lastUsedMs > b.lastUsedMs;
+            return a.instanceId < b.instanceId;
+        });
+        return list;
+    }
+
+    /// Register an instance directory found on disk, dated by its mtime
+    void adopt(const QFileInfo& dir)
+    {
+        const qint64 modified = dir.lastModified().toMSecsSinceEpoch();
+        const QDateTime birth = dir.birthTime();
+        const qint64 created = birth.isValid() ? birth.toMSecsSinceEpoch() : modified;
+        records.insert(dir.fileName(), InstanceRecord{dir.fileName(), created, modified});
+        dirty = true;
+    }
+
+    /// Drop records whose directory is gone and adopt unregistered directories
+    void syncWithDisk(const QString& modulePath)
+    {
+        const QFileInfoList dirs = QDir(modulePath).entryInfoList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+        QSet<QString> present;
+        for (const QFileInfo& dir : dirs) {
+            present.insert(dir.fileName());
+            if (!records.contains(dir.fileName())) {
+                adopt(dir);
+            }
+        }
+        const QStringList known = records.keys();
+        for (const QString& instanceId : known) {
+            if (!present.contains(instanceId)) {
+                remove(instanceId);
+            }
+        }
+        if (mostRecent.isEmpty() && !dirs.isEmpty()) {
+            mostRecent = dirs.first().fileName();
+        }
+    }
+
+    static Registry load(const QString& modulePath)
+    {
+        Registry registry;
+
+        QFile file(registryPath(modulePath));
+        if (file.open(QIODevice::ReadOnly)) {
+            const QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+            if (root.value("version").toInt() == RegistryFormatVersion) {
+                const QJsonObject instances = root.value("instances").toObject();
+                for (auto it = instances.constBegin(); it != instances.constEnd(); ++it) {
+                    const QJsonObject entry = it.value().toObject();
+                    registry.records.insert(it.key(), InstanceRecord{
+                        it.key(),
+                        static_cast<qint64>(entry.value("created_ms").toDouble()),
+                        static_cast<qint64>(entry.value("last_used_ms").toDouble())});
+                }
+                registry.mostRecent = root.value("most_recent").toString();
+                if (!registry.records.contains(registry.mostRecent)) {
+                    registry.mostRecent.clear();
+                    const std::vector<InstanceRecord> byUse = registry.sorted();
+                    if (!byUse.empty()) {
+                        registry.mostRecent = byUse.front().instanceId;
+                    }
+                }
+                return registry;
+            }
+            qWarning() << "InstancePersistence: ignoring unreadable instance registry:" << file.fileName();
+        }
+
+        // No registry yet (instances made by older versions): adopt the
+        // existing directories, reusing the first by name as before
+        registry.syncWithDisk(modulePath);
+        return registry;
+    }
+
+    bool save(const QString& modulePath) const
+    {
+        QJsonObject instances;
+        for (const InstanceRecord& record : records) {
+            QJsonObject entry;
+            entry["created_ms"] = static_cast<double>(record.createdMs);
+            entry["last_used_ms"] = static_cast<double>(record.lastUsedMs);
+            instances[record.instanceId] = entry;
+        }
+
+        QJsonObject root;
+        root["version"] = RegistryFormatVersion;
+        root["most_recent"] = mostRecent;
+        root["instances"] = instances;
+
+        QSaveFile out(registryPath(modulePath));
+        if (!out.open(QIODevice::WriteOnly)) {
+            return false;
+        }
+        out.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+        return out.commit();
+    }
+};
+
+/// Batches touching more modules than this list the base directory once;
+/// smaller ones stat each module directory instead
+constexpr qsizetype ListingThreshold = 16;
+
+/// What a resolveInstances() batch has learned about the base directory
+struct DirectoryListing {
+    QString basePath;
+    QString canonicalBase;
+    bool listWhole;                          // list the base directory rather than stat modules
+    std::optional<QSet<QString>> modules;    // module directories known to exist, listed on first use
+    QHash<QString, bool> checked;            // per module, stat'ed on first use (small batches)
+    QHash<QString, Registry> registries;     // per module, loaded on first use
+
+    DirectoryListing(const QString& base, qsizetype moduleCount)
+        : basePath(base)
+        , canonicalBase(QFileInfo(base).absoluteFilePath())
+        , listWhole(moduleCount > ListingThreshold)
+    {
+    }
+
+    QString modulePath(const QString& moduleName) const {
+        return basePath + "/" + moduleName;
+    }
+
+    bool moduleExists(const QString& moduleName) {
+        if (!listWhole) {
+            auto it = checked.find(moduleName);
+            if (it == checked.end()) {
+                it = checked.insert(moduleName, QFileInfo(modulePath(moduleName)).isDir());
+            }
+            return *it;
+        }
+        if (!modules) {
+            const QStringList entries = QDir(basePath).entryList(QDir::Dirs | QDir::NoDotAndDotDot);
+            modules = QSet<QString>(entries.begin(), entries.end());
+        }
+        return modules->contains(moduleName);
+    }
+
+    Registry& registryOf(const QString& moduleName) {
+        auto it = registries.find(moduleName);
+        if (it == registries.end()) {
+            it = registries.insert(moduleName, moduleExists(moduleName)
+                ? Registry::load(modulePath(moduleName)) : Registry());
+        }
+        return *it;
+    }
+
+    void moduleCreated(const QString& moduleName) {
+        if (modules) {
+            modules->insert(moduleName);
+        }
+        checked.insert(moduleName, true);
+    }
+
+    /// Write back the registries this batch changed
+    void save() {
+        for (auto it = registries.cbegin(); it != registries.cend(); ++it) {
+            if (it->dirty && !it->save(modulePath(it.key()))) {
+                qWarning() << "InstancePersistence: failed to write instance registry for" << it.key();
+            }
+        }
+    }
+};
+
+InstanceInfo resolveOne(DirectoryListing& listing, const QString& moduleName,
+                        ResolveMode mode, const QString& explicitInstanceId, qint64 now)
+{
+    if (moduleName.isEmpty()) {
         qWarning() << "InstancePersistence::resolveInstance: basePath and moduleName must not be empty";
         return {};
     }
@@ -40,7 +264,9 @@ InstanceInfo resolveInstance(const QString& basePath,
         return {};
     }
 
+    Registry& registry = listing.registryOf(moduleName);
     QString instanceId;
+    bool exists = false;
 
     switch (mode) {
     case ResolveMode::UseExplicit:
@@ -53,56 +279,241 @@ InstanceInfo resolveInstance(const QString& basePath,
             return {};
         }
         instanceId = explicitInstanceId;
+        // Reused as is when present; a missing module directory means it is not
+        exists = listing.moduleExists(moduleName)
+            && QFileInfo(listing.modulePath(moduleName) + "/" + instanceId).isDir();
         break;
 
     case ResolveMode::AlwaysCreate:
         instanceId = generateInstanceId();
         break;
 
-    case ResolveMode::ReuseOrCreate: {
-        QDir moduleDir(basePath + "/" + moduleName);
-        if (moduleDir.exists()) {
-            QStringList entries = moduleDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
-            if (!entries.isEmpty()) {
-                instanceId = entries.first();
+    case ResolveMode::ReuseOrCreate:
+        // The registry names the most recently used instance; skip (and
+        // forget) instances whose directory was removed behind its back
+        while (!registry.mostRecent.isEmpty()) {
+            if (QFileInfo::exists(listing.modulePath(moduleName) + "/" + registry.mostRecent)) {
+                instanceId = registry.mostRecent;
+                exists = true;
+                break;
             }
+            registry.remove(registry.mostRecent);
         }
         if (instanceId.isEmpty()) {
             instanceId = generateInstanceId();
         }
         break;
     }
-    }
 
-    QString persistencePath = basePath + "/" + moduleName + "/" + instanceId;
+    QString persistencePath = listing.modulePath(moduleName) + "/" + instanceId;
 
     // Verify the resolved path is still within basePath (defense in depth)
-    QString canonicalBase = QFileInfo(basePath).absoluteFilePath();
     QString canonicalPath = QFileInfo(persistencePath).absoluteFilePath();
-    if (!canonicalPath.startsWith(canonicalBase + "/")) {
+    if (!canonicalPath.startsWith(listing.canonicalBase + "/")) {
         qWarning() << "InstancePersistence::resolveInstance: resolved path escapes base directory:" << persistencePath;
         return {};
     }
 
-    QDir dir;
-    if (!dir.mkpath(persistencePath)) {
-        qWarning() << "InstancePersistence::resolveInstance: failed to create directory:" << persistencePath;
-        return {};
+    // A missing instance under a module directory that exists needs a single
+    // mkdir rather than mkpath's walk from the root
+    if (!exists) {
+        const bool created = listing.moduleExists(moduleName)
+            ? QDir(listing.modulePath(moduleName)).mkdir(instanceId)
+            : QDir().mkpath(persistencePath);
+        if (!created) {
+            qWarning() << "InstancePersistence::resolveInstance: failed to create directory:" << persistencePath;
+            return {};
+        }
+        listing.moduleCreated(moduleName);
     }
 
+    registry.touch(instanceId, now);
     return {instanceId, persistencePath};
 }
 
-StdInstanceInfo resolveInstance(const std::string& basePath,
-                                const std::string& moduleName,
+/// Load a module's registry for list/prune, reconciled with the directories on disk
+std::optional<Registry> loadSyncedRegistry(const QString& basePath, const QString& moduleName,
+                                           const char* caller)
+{
+    if (basePath.isEmpty() || !isValidPathSegment(moduleName)) {
+        qWarning() << "InstancePersistence::" << caller << ": invalid basePath or moduleName:" << moduleName;
+        return std::nullopt;
+    }
+    const QString modulePath = basePath + "/" + moduleName;
+    if (!QFileInfo(modulePath).isDir()) {
+        return Registry();
+    }
+    Registry registry = Registry::load(modulePath);
+    registry.syncWithDisk(modulePath);
+    return registry;
+}
+
+StdInstanceRecord toStd(const InstanceRecord& record)
+{
+    return {record.instanceId.toStdString(), record.createdMs, record.lastUsedMs};
+}
+
+}  // namespace
+
+std::vector<InstanceInfo> resolveInstances(const QString& basePath,
+                                           const std::vector<InstanceRequest>& requests)
+{
+    std::vector<InstanceInfo> results(requests.size());
+    if (basePath.isEmpty()) {
+        qWarning() << "InstancePersistence::resolveInstances: basePath must not be empty";
+        return results;
+    }
+
+    QSet<QString> moduleNames;
+    for (const InstanceRequest& request : requests) {
+        moduleNames.insert(request.moduleName);
+    }
+    DirectoryListing listing(basePath, moduleNames.size());
+    const qint64 now = nowMs();
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+        const InstanceRequest& request = requests[i];
+        results[i] = resolveOne(listing, request.moduleName, request.mode, request.explicitInstanceId, now);
+    }
+    listing.save();
+    return results;
+}
+
+std::vector<StdInstanceInfo> resolveInstances(const std::string& basePath,
+                                              const std::vector<StdInstanceRequest>& requests)
+{
+    std::vector<InstanceRequest> qRequests;
+    qRequests.reserve(requests.size());
+    for (const StdInstanceRequest& request : requests) {
+        qRequests.push_back({QString::fromStdString(request.moduleName), request.mode,
+                             QString::fromStdString(request.explicitInstanceId)});
+    }
+
+    std::vector<StdInstanceInfo> results;
+    results.reserve(requests.size());
+    for (const InstanceInfo& info : resolveInstances(QString::fromStdString(basePath), qRequests)) {
+        results.push_back({info.instanceId.toStdString(), info.persistencePath.toStdString()});
+    }
+    return results;
+}
+
+std::vector<InstanceRecord> listInstances(const QString& basePath, const QString& moduleName)
+{
+    std::optional<Registry> registry = loadSyncedRegistry(basePath, moduleName, "listInstances");
+    if (!registry) {
+        return {};
+    }
+    return registry->sorted();
+}
+
+std::vector<StdInstanceRecord> listInstances(const std::string& basePath, const std::string& moduleName)
+{
+    std::vector<StdInstanceRecord> records;
+    for (const InstanceRecord& record : listInstances(QString::fromStdString(basePath),
+                                                      QString::fromStdString(moduleName))) {
+        records.push_back(toStd(record));
+    }
+    return records;
+}
+
+bool removeInstance(const QString& basePath, const QString& moduleName, const QString& instanceId)
+{
+    if (!isValidPathSegment(instanceId)) {
+        qWarning() << "InstancePersistence::removeInstance: instanceId contains invalid characters:" << instanceId;
+        return false;
+    }
+    std::optional<Registry> registry = loadSyncedRegistry(basePath, moduleName, "removeInstance");
+    if (!registry || !registry->records.contains(instanceId)) {
+        return false;
+    }
+
+    const QString modulePath = basePath + "/" + moduleName;
+    if (!QDir(modulePath + "/" + instanceId).removeRecursively()) {
+        qWarning() << "InstancePersistence::removeInstance: failed to remove" << modulePath + "/" + instanceId;
+        return false;
+    }
+    registry->remove(instanceId);
+    if (!registry->save(modulePath)) {
+        qWarning() << "InstancePersistence: failed to write instance registry for" << moduleName;
+    }
+    return true;
+}
+
+bool removeInstance(const std::string& basePath, const std::string& moduleName, const std::string& instanceId)
+{
+    return removeInstance(QString::fromStdString(basePath), QString::fromStdString(moduleName),
+                          QString::fromStdString(instanceId));
+}
+
+QStringList pruneInstances(const QString& basePath, const QString& moduleName,
+                           qint64 maxIdleMs, std::size_t keepMostRecent)
+{
+    std::optional<Registry> registry = loadSyncedRegistry(basePath, moduleName, "pruneInstances");
+    if (!registry) {
+        return {};
+    }
+
+    const QString modulePath = basePath + "/" + moduleName;
+    const qint64 cutoff = nowMs() - maxIdleMs;
+    const std::vector<InstanceRecord> records = registry->sorted();
+
+    QStringList removed;
+    for (std::size_t i = keepMostRecent; i < records.size(); ++i) {
+        const InstanceRecord& record = records[i];
+        if (record.lastUsedMs >= cutoff) {
+            continue;
+        }
+        if (!QDir(modulePath + "/" + record.instanceId).removeRecursively()) {
+            qWarning() << "InstancePersistence::pruneInstances: failed to remove"
+                       << modulePath + "/" + record.instanceId;
+            continue;
+        }
+        registry->remove(record.instanceId);
+        removed.append(record.instanceId);
+    }
+
+    if (registry->dirty && !registry->save(modulePath)) {
+        qWarning() << "InstancePersistence: failed to write instance registry for" << moduleName;
+    }
+    return removed;
+}
+
+std::vector<std::string> pruneInstances(const std::string& basePath, const std::string& moduleName,
+                                        std::int64_t maxIdleMs, std::size_t keepMostRecent)
+{
+    std::vector<std::string> removed;
+    for (const QString& instanceId : pruneInstances(QString::fromStdString(basePath),
+                                                    QString::fromStdString(moduleName),
+                                                    static_cast<qint64>(maxIdleMs), keepMostRecent)) {
+        removed.push_back(instanceId.toStdString());
+    }
+    return removed;
+}
+
+InstanceInfo resolveInstance(const QString& basePath,
+                             const QString& moduleName,
+                             ResolveMode mode,
+                             const QString& explicitInstanceId)
+{
+    if (basePath.isEmpty() || moduleName.isEmpty()) {
+        qWarning() << "InstancePersistence::resolveInstance: basePath and moduleName must not be empty";
+        return {};
+    }
+    return resolveInstances(basePath, {{moduleName, mode, explicitInstanceId}}).front();
+}
+
+StdInstanceInfo resolveInstance(std::string_view basePath,
+                                std::string_view moduleName,
                                 ResolveMode mode,
-                                const std::string& explicitInstanceId)
+                                std::string_view explicitInstanceId)
 {
+    const auto toQString = [](std::string_view text) {
+        return QString::fromUtf8(text.data(), static_cast<qsizetype>(text.size()));
+    };
     InstanceInfo info = resolveInstance(
-        QString::fromStdString(basePath),
-        QString::fromStdString(moduleName),
+        toQString(basePath),
+        toQString(moduleName),
         mode,
-        QString::fromStdString(explicitInstanceId));
+        toQString(explicitInstanceId));
     return {info.instanceId.toStdString(), info.persistencePath.toStdString()};
 }
 
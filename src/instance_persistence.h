@@ -2,7 +2,12 @@
 #define INSTANCE_PERSISTENCE_H
 
 #include <QString>
+#include <QStringList>
+#include <cstddef>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <vector>
 
 /**
  * @brief Utilities for resolving per-module-instance persistence directories.
@@ -10,6 +15,21 @@
  * Each module instance gets a unique ID and a dedicated directory on disk
  * for storing persistent state, structured as:
  *   {basePath}/{moduleName}/{instanceId}
+ *
+ * Each module directory also holds a registry file (RegistryFileName)
+ * recording when every instance was created and last resolved, and which
+ * one was used most recently:
+ *   {"version": 1, "most_recent": "<id>",
+ *    "instances": {"<id>": {"created_ms": ..., "last_used_ms": ...}}}
+ *
+ * The registry is rewritten (atomically, through QSaveFile) only when a
+ * resolve changes it; reusing the most recent instance again only records
+ * the new use once LastUsedGranularityMs have passed. The file is not
+ * locked: when processes resolve the same module concurrently, the last
+ * writer wins and the others' updates to it are lost. That affects only
+ * the recorded times and the most recent instance; no directory is lost,
+ * and instances missing from the registry are adopted again by
+ * listInstances() and pruneInstances().
  */
 namespace ModuleLib {
 namespace InstancePersistence {
@@ -18,8 +38,8 @@ namespace InstancePersistence {
  * @brief Controls how resolveInstance() picks or creates an instance ID.
  */
 enum class ResolveMode {
-    /// Use the first existing instance directory found for the module.
-    /// If none exist, create a new one.
+    /// Use the most recently used instance of the module, as recorded in its
+    /// registry. If none exist, create a new one.
     ReuseOrCreate,
 
     /// Always generate a fresh instance ID, ignoring any existing directories.
@@ -30,6 +50,15 @@ enum class ResolveMode {
     UseExplicit
 };
 
+/// Name of the per-module instance registry, inside {basePath}/{moduleName}.
+inline constexpr const char* RegistryFileName = ".instances.json";
+
+/// Current registry format version; registries with any other version are rebuilt.
+inline constexpr int RegistryFormatVersion = 1;
+
+/// Resolution of the recorded last-use times of a module's most recent instance.
+inline constexpr qint64 LastUsedGranularityMs = 60 * 1000;
+
 struct InstanceInfo {
     QString instanceId;
     QString persistencePath;  // full path: basePath/moduleName/instanceId
@@ -59,7 +88,7 @@ InstanceInfo resolveInstance(const QString& basePath,
                              const QString& explicitInstanceId = QString());
 
 /**
- * @brief Resolve (or create) an instance directory for the given module (std::string overload).
+ * @brief Resolve (or create) an instance directory for the given module (std::string_view overload).
  *
  * @param basePath           Root persistence directory (e.g. ~/.logoscore/data)
  * @param moduleName         Name of the module (must be a simple name, no path separators or "..")
@@ -68,10 +97,121 @@ InstanceInfo resolveInstance(const QString& basePath,
  * @return StdInstanceInfo with the resolved ID and full path.
  *         Returns empty strings if inputs are invalid or directory creation fails.
  */
-StdInstanceInfo resolveInstance(const std::string& basePath,
-                                const std::string& moduleName,
+StdInstanceInfo resolveInstance(std::string_view basePath,
+                                std::string_view moduleName,
                                 ResolveMode mode = ResolveMode::ReuseOrCreate,
-                                const std::string& explicitInstanceId = std::string());
+                                std::string_view explicitInstanceId = {});
+
+/**
+ * @brief One module's entry in a resolveInstances() batch.
+ */
+struct InstanceRequest {
+    QString moduleName;
+    ResolveMode mode = ResolveMode::ReuseOrCreate;
+    QString explicitInstanceId;  // used when mode is UseExplicit
+};
+
+struct StdInstanceRequest {
+    std::string moduleName;
+    ResolveMode mode = ResolveMode::ReuseOrCreate;
+    std::string explicitInstanceId;  // used when mode is UseExplicit
+};
+
+/**
+ * @brief Resolve (or create) the instance directories of many modules at once.
+ *
+ * Equivalent to calling resolveInstance() for each request in order, but the
+ * base directory is listed at most once (small batches, such as a single
+ * resolveInstance(), only stat their module directories), each module's
+ * registry is read at most once
+ * and written back once at the end, and instances that are known to exist
+ * are not created again. A module requested several times sees the
+ * instances created by its earlier requests, as with sequential calls.
+ *
+ * @param basePath Root persistence directory (e.g. ~/.logoscore/data)
+ * @param requests The modules to resolve
+ * @return One InstanceInfo per request, in request order; empty strings for
+ *         requests that are invalid or whose directory could not be created
+ */
+std::vector<InstanceInfo> resolveInstances(const QString& basePath,
+                                           const std::vector<InstanceRequest>& requests);
+
+/**
+ * @brief Resolve (or create) the instance directories of many modules at once (std::string overload).
+ *
+ * @param basePath Root persistence directory (e.g. ~/.logoscore/data)
+ * @param requests The modules to resolve
+ * @return One StdInstanceInfo per request, in request order
+ */
+std::vector<StdInstanceInfo> resolveInstances(const std::string& basePath,
+                                              const std::vector<StdInstanceRequest>& requests);
+
+/**
+ * @brief An instance's registry entry (times in ms since the epoch).
+ */
+struct InstanceRecord {
+    QString instanceId;
+    qint64 createdMs = 0;
+    qint64 lastUsedMs = 0;
+};
+
+struct StdInstanceRecord {
+    std::string instanceId;
+    std::int64_t createdMs = 0;
+    std::int64_t lastUsedMs = 0;
+};
+
+/**
+ * @brief List the instances of a module, most recently used first.
+ *
+ * The registry is reconciled with the directories on disk: entries whose
+ * directory is gone are skipped, and directories missing from the registry
+ * (e.g. created before registries existed) are listed with their
+ * modification time. Nothing is written.
+ *
+ * @param basePath   Root persistence directory
+ * @param moduleName Name of the module
+ * @return The instances; empty if the module has none or the inputs are invalid
+ */
+std::vector<InstanceRecord> listInstances(const QString& basePath, const QString& moduleName);
+
+/**
+ * @brief List the instances of a module, most recently used first (std::string overload).
+ */
+std::vector<StdInstanceRecord> listInstances(const std::string& basePath, const std::string& moduleName);
+
+/**
+ * @brief Delete an instance directory and its registry entry.
+ *
+ * @param basePath   Root persistence directory
+ * @param moduleName Name of the module
+ * @param instanceId Instance to remove
+ * @return true if the instance existed and was removed
+ */
+bool removeInstance(const QString& basePath, const QString& moduleName, const QString& instanceId);
+
+/**
+ * @brief Delete an instance directory and its registry entry (std::string overload).
+ */
+bool removeInstance(const std::string& basePath, const std::string& moduleName, const std::string& instanceId);
+
+/**
+ * @brief Delete the instances of a module that have not been used for a while.
+ *
+ * @param basePath       Root persistence directory
+ * @param moduleName     Name of the module
+ * @param maxIdleMs      Instances last used longer ago than this are removed
+ * @param keepMostRecent Number of most recently used instances that are always kept
+ * @return The IDs of the removed instances
+ */
+QStringList pruneInstances(const QString& basePath, const QString& moduleName,
+                           qint64 maxIdleMs, std::size_t keepMostRecent = 1);
+
+/**
+ * @brief Delete the instances of a module that have not been used for a while (std::string overload).
+ */
+std::vector<std::string> pruneInstances(const std::string& basePath, const std::string& moduleName,
+                                        std::int64_t maxIdleMs, std::size_t keepMostRecent = 1);
 
 }  // namespace InstancePersistence
 }  // namespace ModuleLib
@@ -0,0 +1,149 @@
+#include "interface_sidecar.h"
+#include "file_identity.h"
+#include "logos_module.h"
+#include <QCryptographicHash>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QSaveFile>
+#include <QDebug>
+#include <map>
+#include <mutex>
+
+namespace ModuleLib {
+
+namespace {
+// Checksums of plugin files, keyed by absolute path and stamped with the
+// identity of the file they were computed from.
+struct KnownChecksum {
+    FileIdentity identity;
+    QString sha256;
+};
+
+std::mutex s_checksumMutex;
+std::map<QString, KnownChecksum> s_checksums;
+
+void setError(QString* errorString, const QString& message) {
+    if (errorString) {
+        *errorString = message;
+    }
+}
+} // namespace
+
+QString InterfaceSidecar::sidecarPath(const QString& pluginPath) {
+    const QFileInfo info(pluginPath);
+    return info.dir().filePath(info.completeBaseName() + QString::fromLatin1(Suffix));
+}
+
+QString InterfaceSidecar::checksum(const QString& pluginPath) {
+    const QString absolutePath = QFileInfo(pluginPath).absoluteFilePath();
+    const auto identity = FileIdentity::of(absolutePath.toStdString());
+    if (!identity) {
+        return QString();
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(s_checksumMutex);
+        auto it = s_checksums.find(absolutePath);
+        if (it != s_checksums.end() && it->second.identity == *identity) {
+            return it->second.sha256;
+        }
+    }
+
+    QFile file(absolutePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QString();
+    }
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    if (!hash.addData(&file)) {
+        return QString();
+    }
+    const QString sha256 = QString::fromLatin1(hash.result().toHex());
+
+    std::lock_guard<std::mutex> lock(s_checksumMutex);
+    s_checksums[absolutePath] = KnownChecksum{*identity, sha256};
+    return sha256;
+}
+
+std::optional<InterfaceSidecar> InterfaceSidecar::read(const QString& pluginPath,
+                                                       QString* errorString) {
+    QFile file(sidecarPath(pluginPath));
+    if (!file.open(QIODevice::ReadOnly)) {
+        setError(errorString, QStringLiteral("No interface sidecar: ") + file.fileName());
+        return std::nullopt;
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    if (parseError.error != QJsonParseError::NoError || !doc.isObject()) {
+        qWarning() << "InterfaceSidecar: Ignoring unreadable sidecar:" << file.fileName()
+                   << parseError.errorString();
+        setError(errorString, QStringLiteral("Unreadable interface sidecar: ") + file.fileName());
+        return std::nullopt;
+    }
+
+    const QJsonObject root = doc.object();
+    if (root.value("version").toInt() != FormatVersion) {
+        setError(errorString, QStringLiteral("Unsupported interface sidecar version: ") + file.fileName());
+        return std::nullopt;
+    }
+
+    // The size check rejects most stale sidecars without hashing the plugin
+    const QJsonObject binary = root.value("binary").toObject();
+    const QFileInfo pluginInfo(pluginPath);
+    if (!pluginInfo.exists()
+        || binary.value("size").toString() != QString::number(pluginInfo.size())
+        || binary.value("sha256").toString() != checksum(pluginPath)) {
+        setError(errorString, QStringLiteral("Interface sidecar does not match the plugin: ") + file.fileName());
+        return std::nullopt;
+    }
+
+    InterfaceSidecar sidecar;
+    sidecar.m_moduleName = root.value("module").toString();
+    sidecar.m_checksum = binary.value("sha256").toString();
+    sidecar.m_methods = root.value("methods").toArray();
+    sidecar.m_events = root.value("events").toArray();
+    return sidecar;
+}
+
+bool InterfaceSidecar::write(const LogosModule& module, const QString& pluginPath,
+                             const QString& outputPath, QString* errorString) {
+    if (!module.isValid()) {
+        setError(errorString, QStringLiteral("Plugin is not loaded: ") + pluginPath);
+        return false;
+    }
+
+    const QString sha256 = checksum(pluginPath);
+    if (sha256.isEmpty()) {
+        setError(errorString, QStringLiteral("Cannot read plugin file: ") + pluginPath);
+        return false;
+    }
+
+    QJsonObject binary;
+    binary["sha256"] = sha256;
+    binary["size"] = QString::number(QFileInfo(pluginPath).size());
+
+    QJsonObject root;
+    root["version"] = FormatVersion;
+    root["module"] = module.metadata().name;
+    root["binary"] = binary;
+    root["methods"] = module.getMethodsAsJson();
+    root["events"] = module.getEventsAsJson();
+
+    QSaveFile out(outputPath.isEmpty() ? sidecarPath(pluginPath) : outputPath);
+    if (!out.open(QIODevice::WriteOnly)) {
+        setError(errorString, out.errorString());
+        return false;
+    }
+    out.write(QJsonDocument(root).toJson(QJsonDocument::Indented));
+    if (!out.commit()) {
+        setError(errorString, out.errorString());
+        return false;
+    }
+    return true;
+}
+
+} // namespace ModuleLib
@@ -0,0 +1,104 @@
+#ifndef INTERFACE_SIDECAR_H
+#define INTERFACE_SIDECAR_H
+
+#include <QJsonArray>
+#include <QString>
+#include <optional>
+
+namespace ModuleLib {
+
+class LogosModule;
+
+/**
+ * @brief InterfaceSidecar is a plugin's callable surface, stored next to the
+ *        plugin so it can be queried without loading (running) it.
+ *
+ * Methods and events are normally only known once a plugin is instantiated.
+ * The sidecar records what getMethodsAsJson() and getEventsAsJson() return,
+ * in `{dir}/{plugin base name}.interface.json` (e.g. foo_plugin.so ->
+ * foo_plugin.interface.json), together with the SHA-256 of the plugin
+ * binary it was exported from:
+ *
+ * @code
+ * {
+ *   "version": 1,
+ *   "module": "foo",
+ *   "binary": { "sha256": "9f86d0...", "size": "123456" },
+ *   "methods": [ ... ],
+ *   "events": [ ... ]
+ * }
+ * @endcode
+ *
+ * read() only returns a sidecar whose checksum matches the plugin file as it
+ * is now, so a rebuilt plugin never reports a stale interface. Checksums are
+ * memoized per FileIdentity, so repeated reads of an unchanged plugin hash
+ * it once. Sidecars are written at build time by write()
+ * (`lm export-interface <plugin>`).
+ */
+class InterfaceSidecar {
+public:
+    /// Suffix replacing the plugin's last file suffix.
+    static constexpr const char* Suffix = ".interface.json";
+
+    /// Current on-disk format version; sidecars with any other version are ignored.
+    static constexpr int FormatVersion = 1;
+
+    /**
+     * @brief Path of the sidecar of a plugin file.
+     */
+    static QString sidecarPath(const QString& pluginPath);
+
+    /**
+     * @brief SHA-256 of a plugin file as lowercase hex.
+     *
+     * @param pluginPath Path to the plugin file
+     * @return QString The checksum, or an empty string if the file cannot be read
+     */
+    static QString checksum(const QString& pluginPath);
+
+    /**
+     * @brief Read and verify the sidecar of a plugin file.
+     *
+     * @param pluginPath  Path to the plugin file
+     * @param errorString Optional pointer to receive why no sidecar could be used
+     * @return std::optional<InterfaceSidecar> The sidecar, or std::nullopt if there is
+     *         none, it cannot be parsed, or it does not match the plugin binary
+     */
+    static std::optional<InterfaceSidecar> read(const QString& pluginPath,
+                                                QString* errorString = nullptr);
+
+    /**
+     * @brief Export the interface of a loaded plugin as a sidecar.
+     *
+     * @param module      The plugin, loaded from @p pluginPath
+     * @param pluginPath  Path to the plugin file (checksummed)
+     * @param outputPath  Where to write the sidecar (default: sidecarPath(pluginPath))
+     * @param errorString Optional pointer to receive an error message on failure
+     * @return bool True if the sidecar was written
+     */
+    static bool write(const LogosModule& module, const QString& pluginPath,
+                      const QString& outputPath = QString(), QString* errorString = nullptr);
+
+    const QString& moduleName() const { return m_moduleName; }
+    const QString& binaryChecksum() const { return m_checksum; }
+
+    /**
+     * @brief The methods array, as LogosModule::getMethodsAsJson() returns it.
+     */
+    const QJsonArray& methods() const { return m_methods; }
+
+    /**
+     * @brief The events array, as LogosModule::getEventsAsJson() returns it.
+     */
+    const QJsonArray& events() const { return m_events; }
+
+private:
+    QString m_moduleName;
+    QString m_checksum;
+    QJsonArray m_methods;
+    QJsonArray m_events;
+};
+
+} // namespace ModuleLib
+
+#endif // INTERFACE_SIDECAR_H
@@ -0,0 +1,170 @@
+#include "interface_table.h"
+#include "logos_module.h"
+#include <QJsonArray>
+#include <QMetaObject>
+
+namespace ModuleLib {
+
+StringPool& StringPool::global() {
+    // Never destroyed: tables held by other statics release into it at exit
+    static StringPool* pool = new StringPool;
+    return *pool;
+}
+
+const QString* StringPool::intern(const QString& value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_strings.try_emplace(value, 0).first;
+    ++it->second;
+    return &it->first;
+}
+
+const QString* StringPool::intern(const QByteArray& utf8) {
+    return intern(QString::fromUtf8(utf8));
+}
+
+void StringPool::release(const QString* value) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_strings.find(*value);
+    if (it != m_strings.end() && --it->second == 0) {
+        m_strings.erase(it);
+    }
+}
+
+std::size_t StringPool::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_strings.size();
+}
+
+MethodInfo InterfaceTable::MethodView::toMethodInfo() const {
+    MethodInfo info;
+    info.name = name();
+    info.signature = signature();
+    info.returnType = returnType();
+    info.isInvokable = isInvokable();
+    info.description = description();
+    info.metaMethodIndex = metaMethodIndex();
+    info.parameters.reserve(parameterCount());
+    for (std::size_t i = 0; i < parameterCount(); ++i) {
+        ParameterInfo param;
+        param.name = parameterName(i);
+        param.type = parameterType(i);
+        info.parameters.push_back(param);
+    }
+    return info;
+}
+
+QJsonObject InterfaceTable::MethodView::toJson() const {
+    QJsonObject obj;
+    obj["name"] = name();
+    obj["signature"] = signature();
+    obj["returnType"] = returnType();
+    obj["isInvokable"] = isInvokable();
+    if (!description().isEmpty()) {
+        obj["description"] = description();
+    }
+
+    if (parameterCount() > 0) {
+        QJsonArray paramsArray;
+        for (std::size_t i = 0; i < parameterCount(); ++i) {
+            QJsonObject param;
+            param["name"] = parameterName(i);
+            param["type"] = parameterType(i);
+            paramsArray.append(param);
+        }
+        obj["parameters"] = paramsArray;
+    }
+
+    return obj;
+}
+
+InterfaceTable::~InterfaceTable() {
+    StringPool& pool = StringPool::global();
+    for (const MethodRecord& record : m_methods) {
+        pool.release(record.name);
+        pool.release(record.signature);
+        pool.release(record.returnType);
+        pool.release(record.description);
+    }
+    for (const ParameterRecord& param : m_parameters) {
+        pool.release(param.name);
+        pool.release(param.type);
+    }
+}
+
+void InterfaceTable::append(const MethodInfo& method) {
+    StringPool& pool = StringPool::global();
+
+    MethodRecord record;
+    record.name = pool.intern(method.name);
+    record.signature = pool.intern(method.signature);
+    record.returnType = pool.intern(method.returnType);
+    record.description = pool.intern(method.description);
+    record.firstParameter = static_cast<std::uint32_t>(m_parameters.size());
+    record.parameterCount = static_cast<std::uint32_t>(method.parameters.size());
+    record.metaMethodIndex = method.metaMethodIndex;
+    record.isInvokable = method.isInvokable;
+
+    for (const auto& param : method.parameters) {
+        m_parameters.push_back({pool.intern(param.name), pool.intern(param.type)});
+    }
+    m_methods.push_back(record);
+}
+
+void InterfaceTable::finalize() {
+    m_methods.shrink_to_fit();
+    m_parameters.shrink_to_fit();
+
+    m_byName.reserve(static_cast<qsizetype>(m_methods.size()));
+    m_bySignature.reserve(static_cast<qsizetype>(m_methods.size()));
+    for (std::uint32_t i = 0; i < m_methods.size(); ++i) {
+        // Overloads share a name: keep the first declared one
+        if (!m_byName.contains(*m_methods[i].name)) {
+            m_byName.insert(*m_methods[i].name, i);
+        }
+        if (!m_bySignature.contains(*m_methods[i].signature)) {
+            m_bySignature.insert(*m_methods[i].signature, i);
+        }
+    }
+}
+
+std::optional<std::size_t> InterfaceTable::indexOfName(const QString& name) const {
+    auto it = m_byName.constFind(name);
+    if (it == m_byName.constEnd()) {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+std::optional<std::size_t> InterfaceTable::indexOfSignature(const QString& signature) const {
+    auto it = m_bySignature.constFind(signature);
+    if (it == m_bySignature.constEnd()) {
+        // Accept "foo(const QString &)" for "foo(QString)"
+        const QString normalized = QString::fromLatin1(
+            QMetaObject::normalizedSignature(signature.toUtf8().constData()));
+        it = m_bySignature.constFind(normalized);
+    }
+    if (it == m_bySignature.constEnd()) {
+        return std::nullopt;
+    }
+    return *it;
+}
+
+std::vector<MethodInfo> InterfaceTable::toMethodInfos(bool excludeBaseClass) const {
+    std::vector<MethodInfo> methods;
+    const std::size_t first = excludeBaseClass ? m_ownOffset : 0;
+    methods.reserve(m_methods.size() - first);
+    for (std::size_t i = first; i < m_methods.size(); ++i) {
+        methods.push_back(method(i).toMethodInfo());
+    }
+    return methods;
+}
+
+std::size_t InterfaceTable::memoryBytes() const {
+    // A QHash node holds the key, the value and a span slot
+    const std::size_t hashEntry = sizeof(QString) + sizeof(std::uint32_t) + 2 * sizeof(void*);
+    return m_methods.capacity() * sizeof(MethodRecord)
+         + m_parameters.capacity() * sizeof(ParameterRecord)
+         + static_cast<std::size_t>(m_byName.capacity() + m_bySignature.capacity()) * hashEntry;
+}
+
+} // namespace ModuleLib
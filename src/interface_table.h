@@ -0,0 +1,218 @@
+#ifndef INTERFACE_TABLE_H
+#define INTERFACE_TABLE_H
+
+#include <QHash>
+#include <QJsonObject>
+#include <QString>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace ModuleLib {
+
+struct MethodInfo;
+
+/**
+ * @brief StringPool interns the strings of plugin interfaces.
+ *
+ * Every distinct string is stored once; intern() returns a pointer that
+ * stays valid until the matching release(). Type names such as "QString",
+ * "QVariant" or "int" and the QObject base-class methods are therefore
+ * shared by all interface tables, whichever module they describe. Entries
+ * are reference counted: each intern() takes one reference and a string is
+ * dropped when its last one is released, so reloading plugins does not
+ * grow the pool. Pooled strings are copies and stay valid after the plugin
+ * that produced them is unloaded.
+ *
+ * intern() and release() are thread-safe; reading through a returned
+ * pointer needs no lock.
+ */
+class StringPool {
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /**
+     * @brief The process-wide pool used by InterfaceTable.
+     */
+    static StringPool& global();
+
+    /**
+     * @brief Return the pooled copy of a string, adding it on first use.
+     *
+     * Takes a reference; pair every call with a release() of the result.
+     */
+    const QString* intern(const QString& value);
+
+    /**
+     * @brief Return the pooled copy of a UTF-8 string, adding it on first use.
+     */
+    const QString* intern(const QByteArray& utf8);
+
+    /**
+     * @brief Drop one reference taken by intern(); the last one removes the string.
+     */
+    void release(const QString* value);
+
+    /**
+     * @brief Number of distinct strings in the pool.
+     */
+    std::size_t size() const;
+
+private:
+    struct Hash {
+        std::size_t operator()(const QString& value) const { return qHash(value); }
+    };
+
+    mutable std::mutex m_mutex;
+    // Node-based: key addresses are stable. Mapped value is the reference count
+    std::unordered_map<QString, std::size_t, Hash> m_strings;
+};
+
+/**
+ * @brief InterfaceTable is a flat, immutable description of a plugin's methods.
+ *
+ * Methods and their parameters live in two contiguous record arrays; each
+ * method addresses its parameters by offset and all strings are pointers
+ * into the global StringPool, released again when the table is destroyed.
+ * Compared to a std::vector<MethodInfo> there is no per-method parameter
+ * allocation and no per-table string storage.
+ * Lookups by name or signature are answered from a hash index built with
+ * the table.
+ *
+ * For legacy (QMetaObject) plugins the table lists every method, inherited
+ * ones first, in meta-method order; ownMethodOffset() marks where the
+ * plugin class's own methods start. Provider tables have no inherited part.
+ *
+ * Example usage:
+ * @code
+ * const InterfaceTable& table = plugin.interfaceTable();
+ * for (std::size_t i = table.ownMethodOffset(); i < table.methodCount(); ++i) {
+ *     InterfaceTable::MethodView method = table.method(i);
+ *     qDebug() << method.signature() << "->" << method.returnType();
+ * }
+ * @endcode
+ */
+class InterfaceTable {
+public:
+    struct ParameterRecord {
+        const QString* name = nullptr;
+        const QString* type = nullptr;
+    };
+
+    struct MethodRecord {
+        const QString* name = nullptr;
+        const QString* signature = nullptr;
+        const QString* returnType = nullptr;
+        const QString* description = nullptr;
+        std::uint32_t firstParameter = 0;
+        std::uint32_t parameterCount = 0;
+        std::int32_t metaMethodIndex = -1;
+        bool isInvokable = false;
+    };
+
+    /**
+     * @brief A lightweight, non-owning view of one method of a table.
+     *
+     * Valid while the table it came from is alive.
+     */
+    class MethodView {
+    public:
+        const QString& name() const { return *m_record->name; }
+        const QString& signature() const { return *m_record->signature; }
+        const QString& returnType() const { return *m_record->returnType; }
+        const QString& description() const { return *m_record->description; }
+        bool isInvokable() const { return m_record->isInvokable; }
+        int metaMethodIndex() const { return m_record->metaMethodIndex; }
+
+        std::size_t parameterCount() const { return m_record->parameterCount; }
+        const QString& parameterName(std::size_t i) const { return *parameter(i).name; }
+        const QString& parameterType(std::size_t i) const { return *parameter(i).type; }
+
+        /**
+         * @brief Materialize as a MethodInfo (the strings are implicitly shared).
+         */
+        MethodInfo toMethodInfo() const;
+
+        /**
+         * @brief Same JSON as MethodInfo::toJson().
+         */
+        QJsonObject toJson() const;
+
+    private:
+        friend class InterfaceTable;
+        MethodView(const InterfaceTable* table, const MethodRecord* record)
+            : m_table(table), m_record(record) {}
+
+        const ParameterRecord& parameter(std::size_t i) const {
+            return m_table->m_parameters[m_record->firstParameter + i];
+        }
+
+        const InterfaceTable* m_table;
+        const MethodRecord* m_record;
+    };
+
+    InterfaceTable() = default;
+    ~InterfaceTable();
+    InterfaceTable(const InterfaceTable&) = delete;
+    InterfaceTable& operator=(const InterfaceTable&) = delete;
+
+    /**
+     * @brief Append a method. Tables are built once, then only read.
+     */
+    void append(const MethodInfo& method);
+
+    /**
+     * @brief Mark the methods appended so far as inherited.
+     */
+    void markOwnMethodsStart() { m_ownOffset = m_methods.size(); }
+
+    /**
+     * @brief Build the name/signature index. Call once after the last append().
+     */
+    void finalize();
+
+    std::size_t methodCount() const { return m_methods.size(); }
+    std::size_t ownMethodOffset() const { return m_ownOffset; }
+    MethodView method(std::size_t i) const { return MethodView(this, &m_methods[i]); }
+
+    /**
+     * @brief Index of the first method with the given name.
+     */
+    std::optional<std::size_t> indexOfName(const QString& name) const;
+
+    /**
+     * @brief Index of the method with the given signature, exact or normalized
+     *        as by QMetaObject::normalizedSignature.
+     */
+    std::optional<std::size_t> indexOfSignature(const QString& signature) const;
+
+    /**
+     * @brief Materialize methods as MethodInfo (inherited ones only if requested).
+     */
+    std::vector<MethodInfo> toMethodInfos(bool excludeBaseClass) const;
+
+    /**
+     * @brief Approximate heap bytes held by the table (records and index).
+     *
+     * Pooled strings are shared with other tables and not counted.
+     */
+    std::size_t memoryBytes() const;
+
+private:
+    std::vector<MethodRecord> m_methods;
+    std::vector<ParameterRecord> m_parameters;
+    std::size_t m_ownOffset = 0;
+
+    // Keys share their data with the pooled strings
+    QHash<QString, std::uint32_t> m_byName;
+    QHash<QString, std::uint32_t> m_bySignature;
+};
+
+} // namespace ModuleLib
+
+#endif // INTERFACE_TABLE_H
@@ -0,0 +1,208 @@
+#include "isolated_introspection.h"
+#include "file_identity.h"
+#include "metadata_cache.h"
+#include <QCborArray>
+#include <QCborMap>
+#include <QCborValue>
+#include <QCoreApplication>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonParseError>
+#include <QProcess>
+#include <QStandardPaths>
+#include <QDebug>
+#include <algorithm>
+#include <mutex>
+
+namespace ModuleLib {
+namespace IsolatedIntrospection {
+
+namespace {
+constexpr int FormatVersion = 1;
+
+// Integer keys keep the encoding small
+enum Key : int {
+    VersionKey = 0,
+    MethodsKey = 1,
+    EventsKey = 2
+};
+
+std::mutex s_programMutex;
+QString s_program;
+
+void setError(QString* errorString, const QString& message) {
+    if (errorString) {
+        *errorString = message;
+    }
+}
+
+// Run `<program> <plugin> --json` and take the interface from its output.
+// The helper is a fresh executable (fork + exec / CreateProcess), so none of
+// this process's locks or plugin state are inherited by it.
+std::optional<IsolatedInterface> runHelper(const QString& program, const QString& pluginPath,
+                                           int timeoutMs, QString* errorString) {
+    QProcess process;
+    process.setProgram(program);
+    process.setArguments({pluginPath, QStringLiteral("--json")});
+    process.setStandardInputFile(QProcess::nullDevice());
+    QProcessEnvironment environment = QProcessEnvironment::systemEnvironment();
+    environment.insert(QString::fromLatin1(HelperProtocolVariable), QString::number(HelperProtocolVersion));
+    process.setProcessEnvironment(environment);
+
+    QElapsedTimer timer;
+    timer.start();
+    process.start(QIODevice::ReadOnly);
+    if (!process.waitForStarted(std::max(0, timeoutMs))
+        && process.error() == QProcess::FailedToStart) {
+        setError(errorString, QStringLiteral("Cannot start the introspection helper %1: %2")
+                                  .arg(program, process.errorString()));
+        return std::nullopt;
+    }
+    const int remaining = static_cast<int>(std::max<qint64>(0, timeoutMs - timer.elapsed()));
+    if (process.state() != QProcess::NotRunning && !process.waitForFinished(remaining)) {
+        process.kill();
+        process.waitForFinished(-1);
+        setError(errorString, QStringLiteral("Introspection helper timed out after %1 ms: %2")
+                                  .arg(timeoutMs).arg(pluginPath));
+        return std::nullopt;
+    }
+
+    const QString helperError = QString::fromLocal8Bit(process.readAllStandardError()).trimmed();
+    if (process.exitStatus() == QProcess::CrashExit) {
+        setError(errorString, QStringLiteral("Introspection helper crashed: ") + pluginPath);
+        return std::nullopt;
+    }
+    if (process.exitCode() != 0) {
+        setError(errorString, helperError.isEmpty()
+                                  ? QStringLiteral("Introspection helper exited with code %1: %2")
+                                        .arg(process.exitCode()).arg(pluginPath)
+                                  : helperError);
+        return std::nullopt;
+    }
+
+    QJsonParseError parseError;
+    const QJsonDocument reply = QJsonDocument::fromJson(process.readAllStandardOutput(), &parseError);
+    const QJsonObject object = reply.object();
+    if (parseError.error != QJsonParseError::NoError
+        || !object.value(QStringLiteral("methods")).isArray()
+        || !object.value(QStringLiteral("events")).isArray()) {
+        setError(errorString, QStringLiteral("Unreadable reply from the introspection helper: ")
+                                  + pluginPath);
+        return std::nullopt;
+    }
+    // Anything else called lm (or an older one) does not echo the handshake
+    if (object.value(QStringLiteral("helperProtocol")).toInt() != HelperProtocolVersion) {
+        setError(errorString, QStringLiteral("%1 is not a compatible introspection helper "
+                                             "(no helperProtocol %2 in its reply)")
+                                  .arg(program).arg(HelperProtocolVersion));
+        return std::nullopt;
+    }
+    return IsolatedInterface{object.value(QStringLiteral("methods")).toArray(),
+                             object.value(QStringLiteral("events")).toArray()};
+}
+
+} // namespace
+
+QString helperProgram() {
+    {
+        std::lock_guard<std::mutex> lock(s_programMutex);
+        if (!s_program.isEmpty()) {
+            return s_program;
+        }
+    }
+    const QString fromEnvironment = qEnvironmentVariable(HelperProgramVariable);
+    if (!fromEnvironment.isEmpty()) {
+        return fromEnvironment;
+    }
+    // The lm installed next to the application, else the one installed with
+    // this library; never whatever lm comes first on PATH
+    if (QCoreApplication::instance()) {
+        const QString besideApplication = QStandardPaths::findExecutable(
+            QStringLiteral("lm"), {QCoreApplication::applicationDirPath()});
+        if (!besideApplication.isEmpty()) {
+            return besideApplication;
+        }
+    }
+#ifdef LOGOS_MODULE_INSTALLED_HELPER
+    const QFileInfo installed(QStringLiteral(LOGOS_MODULE_INSTALLED_HELPER));
+    if (installed.isFile() && installed.isExecutable()) {
+        return installed.filePath();
+    }
+#endif
+    return QString();
+}
+
+void setHelperProgram(const QString& program) {
+    std::lock_guard<std::mutex> lock(s_programMutex);
+    s_program = program;
+}
+
+bool isSupported() {
+    return !helperProgram().isEmpty();
+}
+
+QByteArray encode(const IsolatedInterface& interfaceInfo) {
+    QCborMap map;
+    map.insert(VersionKey, FormatVersion);
+    map.insert(MethodsKey, QCborArray::fromJsonArray(interfaceInfo.methods));
+    map.insert(EventsKey, QCborArray::fromJsonArray(interfaceInfo.events));
+    return map.toCborValue().toCbor();
+}
+
+std::optional<IsolatedInterface> decode(const QByteArray& data) {
+    QCborParserError parseError;
+    const QCborValue value = QCborValue::fromCbor(data, &parseError);
+    if (parseError.error != QCborError::NoError || !value.isMap()) {
+        return std::nullopt;
+    }
+    const QCborMap map = value.toMap();
+    if (map.value(VersionKey).toInteger() != FormatVersion
+        || !map.value(MethodsKey).isArray() || !map.value(EventsKey).isArray()) {
+        return std::nullopt;
+    }
+    return IsolatedInterface{map.value(MethodsKey).toArray().toJsonArray(),
+                             map.value(EventsKey).toArray().toJsonArray()};
+}
+
+std::optional<IsolatedInterface> introspect(const QString& pluginPath, int timeoutMs,
+                                            QString* errorString, MetadataCache* cache) {
+    if (!cache) {
+        cache = &MetadataCache::global();
+    }
+    const QString absolutePath = QFileInfo(pluginPath).absoluteFilePath();
+    const std::optional<FileIdentity> identity = FileIdentity::of(absolutePath.toStdString());
+    if (!identity) {
+        setError(errorString, QStringLiteral("Plugin file not found: ") + pluginPath);
+        return std::nullopt;
+    }
+
+    if (std::optional<QByteArray> cached = cache->interfaceData(absolutePath)) {
+        if (std::optional<IsolatedInterface> result = decode(*cached)) {
+            return result;
+        }
+    }
+
+    const QString program = helperProgram();
+    if (program.isEmpty()) {
+        setError(errorString, QStringLiteral("No introspection helper program (lm) found"));
+        return std::nullopt;
+    }
+
+    QString error;
+    std::optional<IsolatedInterface> result = runHelper(program, absolutePath, timeoutMs, &error);
+    if (!result) {
+        qWarning() << "IsolatedIntrospection:" << error;
+        setError(errorString, error);
+        return std::nullopt;
+    }
+
+    // Keyed by the identity taken before the helper ran: a plugin rewritten
+    // meanwhile is not stored, and is introspected again next time
+    cache->storeInterfaceData(absolutePath, *identity, encode(*result));
+    return result;
+}
+
+} // namespace IsolatedIntrospection
+} // namespace ModuleLib
@@ -0,0 +1,107 @@
+#ifndef ISOLATED_INTROSPECTION_H
+#define ISOLATED_INTROSPECTION_H
+
+#include <QByteArray>
+#include <QJsonArray>
+#include <QString>
+#include <optional>
+
+namespace ModuleLib {
+
+class MetadataCache;
+
+/**
+ * @brief A plugin's callable surface, as taken by IsolatedIntrospection.
+ */
+struct IsolatedInterface {
+    QJsonArray methods;   ///< As LogosModule::getMethodsAsJson() returns it
+    QJsonArray events;    ///< As LogosModule::getEventsAsJson() returns it
+};
+
+/**
+ * @brief Introspection of a plugin in a separate helper process.
+ *
+ * introspect() runs the helper program (`lm <plugin> --json`, see
+ * helperProgram()), which loads the plugin and prints its methods and
+ * events; the plugin's code never runs in the calling process. The helper
+ * is started with fork + exec (CreateProcess on Windows), so it shares none
+ * of the caller's state: locks held by the caller's other threads cannot
+ * stall it. A helper that crashes, exits with an error or runs past the
+ * timeout (it is then killed) only fails that call. Results are kept in a
+ * MetadataCache under the plugin's FileIdentity, encoded as CBOR (see
+ * encode()), so an unchanged plugin is introspected once per process.
+ */
+namespace IsolatedIntrospection {
+
+/// Default time the helper is given to load and describe the plugin.
+constexpr int DefaultTimeoutMs = 30000;
+
+/// Environment variable naming the helper program, consulted by helperProgram().
+constexpr char HelperProgramVariable[] = "LOGOS_MODULE_HELPER";
+
+/// Set in the helper's environment to the protocol version introspect() speaks.
+constexpr char HelperProtocolVariable[] = "LOGOS_MODULE_HELPER_PROTOCOL";
+
+/// Reply version; a helper echoes it as "helperProtocol" or its reply is rejected.
+constexpr int HelperProtocolVersion = 1;
+
+/**
+ * @brief The helper program that introspect() runs.
+ *
+ * The program set with setHelperProgram(), else $LOGOS_MODULE_HELPER, else
+ * an `lm` next to the application, else the `lm` this library was built to
+ * be installed with. The PATH is not searched: an unrelated program named
+ * lm would otherwise be run on the plugin.
+ *
+ * @return QString Path of the program, or empty if none was found
+ */
+QString helperProgram();
+
+/**
+ * @brief Set the helper program; an empty path restores the default lookup.
+ *
+ * The program is run as `<program> <plugin> --json` with
+ * $LOGOS_MODULE_HELPER_PROTOCOL set, and must print a JSON object with
+ * "methods" and "events" arrays and "helperProtocol" equal to
+ * HelperProtocolVersion, as lm does. Other replies are not trusted or cached.
+ */
+void setHelperProgram(const QString& program);
+
+/**
+ * @brief Check if a helper program is available (see helperProgram()).
+ */
+bool isSupported();
+
+/**
+ * @brief Take the interface of a plugin in a child process.
+ *
+ * @param pluginPath  Path to the plugin file
+ * @param timeoutMs   Time after which the helper is killed
+ * @param errorString Optional pointer to receive an error message on failure
+ * @param cache       Cache consulted and filled (default: MetadataCache::global())
+ * @return std::optional<IsolatedInterface> The interface, or std::nullopt if the
+ *         plugin could not be loaded or the helper failed
+ */
+std::optional<IsolatedInterface> introspect(const QString& pluginPath,
+                                            int timeoutMs = DefaultTimeoutMs,
+                                            QString* errorString = nullptr,
+                                            MetadataCache* cache = nullptr);
+
+/**
+ * @brief Encode an interface in the cache format.
+ */
+QByteArray encode(const IsolatedInterface& interfaceInfo);
+
+/**
+ * @brief Decode what encode() produced.
+ *
+ * @return std::optional<IsolatedInterface> The interface, or std::nullopt if the
+ *         bytes are not a well-formed encoding of the current version
+ */
+std::optional<IsolatedInterface> decode(const QByteArray& data);
+
+} // namespace IsolatedIntrospection
+
+} // namespace ModuleLib
+
+#endif // ISOLATED_INTROSPECTION_H
@@ -0,0 +1,214 @@
+#include "json_writer.h"
+#include <QByteArray>
+#include <QCborValue>
+#include <QLocale>
+#include <cmath>
+
+namespace ModuleLib {
+
+JsonWriter::JsonWriter(std::string& out, JsonFormat format)
+    : m_out(out)
+    , m_format(format)
+{
+}
+
+void JsonWriter::appendEscaped(std::string& out, std::string_view utf8) {
+    // Same escaping as QJsonDocument: quote, backslash and control
+    // characters; everything else (including non-ASCII) is copied as UTF-8.
+    static const char hexDigits[] = "0123456789abcdef";
+    for (const char c : utf8) {
+        const unsigned char u = static_cast<unsigned char>(c);
+        if (u >= 0x20 && u != '"' && u != '\\') {
+            out += c;
+            continue;
+        }
+        out += '\\';
+        switch (u) {
+        case '"':  out += '"'; break;
+        case '\\': out += '\\'; break;
+        case '\b': out += 'b'; break;
+        case '\f': out += 'f'; break;
+        case '\n': out += 'n'; break;
+        case '\r': out += 'r'; break;
+        case '\t': out += 't'; break;
+        default:
+            out += "u00";
+            out += hexDigits[u >> 4];
+            out += hexDigits[u & 0xf];
+            break;
+        }
+    }
+}
+
+void JsonWriter::beforeValue() {
+    if (m_afterKey) {
+        // Object member: the key already wrote the separator and indent
+        m_afterKey = false;
+        return;
+    }
+    if (m_counts.empty()) {
+        return;
+    }
+    if (m_counts.back()++ > 0) {
+        m_out += m_format == JsonFormat::Compact ? "," : ",\n";
+    }
+    if (m_format == JsonFormat::Indented) {
+        m_out.append(4 * m_counts.size(), ' ');
+    }
+}
+
+void JsonWriter::open(char bracket) {
+    beforeValue();
+    m_out += bracket;
+    if (m_format == JsonFormat::Indented) {
+        m_out += '\n';
+    }
+    m_counts.push_back(0);
+}
+
+void JsonWriter::close(char bracket) {
+    const bool hadMembers = m_counts.back() > 0;
+    m_counts.pop_back();
+    if (m_format == JsonFormat::Indented) {
+        if (hadMembers) {
+            m_out += '\n';
+        }
+        m_out.append(4 * m_counts.size(), ' ');
+    }
+    m_out += bracket;
+    if (m_counts.empty() && m_format == JsonFormat::Indented) {
+        m_out += '\n';
+    }
+}
+
+void JsonWriter::writeString(std::string_view utf8) {
+    m_out += '"';
+    appendEscaped(m_out, utf8);
+    m_out += '"';
+}
+
+JsonWriter& JsonWriter::beginObject() {
+    open('{');
+    return *this;
+}
+
+JsonWriter& JsonWriter::endObject() {
+    close('}');
+    return *this;
+}
+
+JsonWriter& JsonWriter::beginArray() {
+    open('[');
+    return *this;
+}
+
+JsonWriter& JsonWriter::endArray() {
+    close(']');
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(std::string_view name) {
+    beforeValue();
+    writeString(name);
+    m_out += m_format == JsonFormat::Compact ? ":" : ": ";
+    m_afterKey = true;
+    return *this;
+}
+
+JsonWriter& JsonWriter::key(const QString& name) {
+    const QByteArray utf8 = name.toUtf8();
+    return key(std::string_view(utf8.constData(), static_cast<size_t>(utf8.size())));
+}
+
+JsonWriter& JsonWriter::value(const QString& text) {
+    const QByteArray utf8 = text.toUtf8();
+    return value(std::string_view(utf8.constData(), static_cast<size_t>(utf8.size())));
+}
+
+JsonWriter& JsonWriter::value(std::string_view text) {
+    beforeValue();
+    writeString(text);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(bool flag) {
+    beforeValue();
+    m_out += flag ? "true" : "false";
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(long long number) {
+    beforeValue();
+    m_out += std::to_string(number);
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(double number) {
+    beforeValue();
+    if (std::isfinite(number)) {
+        m_out += QByteArray::number(number, 'g', QLocale::FloatingPointShortest).toStdString();
+    } else {
+        m_out += "null";
+    }
+    return *this;
+}
+
+JsonWriter& JsonWriter::nullValue() {
+    beforeValue();
+    m_out += "null";
+    return *this;
+}
+
+JsonWriter& JsonWriter::rawValue(std::string_view json) {
+    beforeValue();
+    if (!json.empty() && json.back() == '\n') {
+        json.remove_suffix(1);
+    }
+    m_out.append(json.data(), json.size());
+    return *this;
+}
+
+JsonWriter& JsonWriter::value(const QJsonValue& json) {
+    switch (json.type()) {
+    case QJsonValue::Bool:
+        return value(json.toBool());
+    case QJsonValue::Double: {
+        // QJsonValue keeps integers exact; print them as QJsonDocument does
+        const QCborValue number = QCborValue::fromJsonValue(json);
+        if (number.isInteger()) {
+            return value(static_cast<long long>(number.toInteger()));
+        }
+        return value(json.toDouble());
+    }
+    case QJsonValue::String:
+        return value(json.toString());
+    case QJsonValue::Array:
+        return value(json.toArray());
+    case QJsonValue::Object:
+        return value(json.toObject());
+    case QJsonValue::Null:
+    case QJsonValue::Undefined:
+        break;
+    }
+    return nullValue();
+}
+
+JsonWriter& JsonWriter::value(const QJsonObject& json) {
+    beginObject();
+    // QJsonObject iterates in sorted key order, as QJsonDocument writes it
+    for (auto it = json.constBegin(); it != json.constEnd(); ++it) {
+        key(it.key());
+        value(it.value());
+    }
+    return endObject();
+}
+
+JsonWriter& JsonWriter::value(const QJsonArray& json) {
+    beginArray();
+    for (const QJsonValue& element : json) {
+        value(element);
+    }
+    return endArray();
+}
+
+} // namespace ModuleLib
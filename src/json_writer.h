@@ -0,0 +1,104 @@
+#ifndef JSON_WRITER_H
+#define JSON_WRITER_H
+
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonValue>
+#include <QString>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ModuleLib {
+
+/**
+ * @brief Output layout of JsonWriter.
+ *
+ * Both layouts are byte-for-byte what QJsonDocument::toJson() produces with
+ * QJsonDocument::Indented / QJsonDocument::Compact, provided object keys are
+ * written in sorted order as QJsonObject would store them.
+ */
+enum class JsonFormat {
+    Indented,
+    Compact
+};
+
+/**
+ * @brief JsonWriter streams JSON text straight into a std::string.
+ *
+ * No QJsonObject/QJsonDocument tree is built: containers, keys and values
+ * are appended as they are written. Existing QJson values (e.g. a provider's
+ * interface array) can be embedded without conversion. The writer does not
+ * validate call order beyond what is needed for layout; callers write a
+ * well-formed sequence (a key before every object member).
+ *
+ * Example usage:
+ * @code
+ * std::string text;
+ * JsonWriter writer(text);
+ * writer.beginObject();
+ * writer.key("name").value(QStringLiteral("my_module"));
+ * writer.key("methods");
+ * plugin.writeMethodsJson(writer);
+ * writer.endObject();
+ * @endcode
+ */
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out, JsonFormat format = JsonFormat::Indented);
+
+    JsonWriter& beginObject();
+    JsonWriter& endObject();
+    JsonWriter& beginArray();
+    JsonWriter& endArray();
+
+    /**
+     * @brief Write an object member's key; the next call writes its value.
+     */
+    JsonWriter& key(std::string_view name);
+    JsonWriter& key(const QString& name);
+    JsonWriter& key(const char* name) { return key(std::string_view(name)); }
+
+    JsonWriter& value(const QString& text);
+    JsonWriter& value(std::string_view text);
+    JsonWriter& value(const char* text) { return value(std::string_view(text)); }
+    JsonWriter& value(bool flag);
+    JsonWriter& value(long long number);
+    JsonWriter& value(long number) { return value(static_cast<long long>(number)); }
+    JsonWriter& value(int number) { return value(static_cast<long long>(number)); }
+    JsonWriter& value(double number);
+    JsonWriter& value(const QJsonValue& json);
+    JsonWriter& value(const QJsonObject& json);
+    JsonWriter& value(const QJsonArray& json);
+    JsonWriter& nullValue();
+
+    /**
+     * @brief Write already-serialized JSON (e.g. a memoized document) as a value.
+     *
+     * The text is copied verbatim, minus one trailing newline; it is not
+     * re-indented, so nesting an Indented document is valid JSON but only
+     * laid out exactly in Compact output.
+     */
+    JsonWriter& rawValue(std::string_view json);
+
+    /**
+     * @brief Append JSON-escaped UTF-8 text (without quotes) to a string.
+     */
+    static void appendEscaped(std::string& out, std::string_view utf8);
+
+private:
+    void beforeValue();
+    void open(char bracket);
+    void close(char bracket);
+    void writeString(std::string_view utf8);
+
+    std::string& m_out;
+    JsonFormat m_format;
+    std::vector<std::uint32_t> m_counts;  // members written per open container
+    bool m_afterKey = false;
+};
+
+} // namespace ModuleLib
+
+#endif // JSON_WRITER_H
@@ -1,7 +1,25 @@
 #include "logos_module.h"
+#include "interface_sidecar.h"
+#include "interface_table.h"
+#include "isolated_introspection.h"
+#include "json_writer.h"
 #include "logos_provider_plugin.h"
+#include "metadata_cache.h"
+#include "metadata_index.h"
+#include "output_capture.h"
+#include <QDir>
+#include <QElapsedTimer>
+#include <QFileInfo>
+#include <QHash>
 #include <QMetaObject>
+#include <QPointer>
+#include <QThread>
+#include <QThreadPool>
 #include <QMetaMethod>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace ModuleLib {
 
@@ -33,6 +51,498 @@ QJsonObject MethodInfo::toJson() const {
     return obj;
 }
 
+MethodInfo MethodInfo::fromJson(const QJsonObject& mo) {
+    MethodInfo info;
+    info.name = mo["name"].toString();
+    info.signature = mo["signature"].toString();
+    info.returnType = mo["returnType"].toString();
+    info.isInvokable = mo["isInvokable"].toBool(true);
+    info.description = mo["description"].toString();
+    QJsonArray params = mo["parameters"].toArray();
+    for (const QJsonValue& pv : params) {
+        QJsonObject po = pv.toObject();
+        ParameterInfo param;
+        param.name = po["name"].toString();
+        param.type = po["type"].toString();
+        info.parameters.push_back(param);
+    }
+    return info;
+}
+
+qint64 LoadStats::loadNs() const {
+    qint64 total = 0;
+    for (qint64 phase : {metadataReadNs, libraryLoadNs, instanceNs}) {
+        if (phase >= 0) {
+            total += phase;
+        }
+    }
+    return total;
+}
+
+QJsonObject LoadStats::toJson() const {
+    QJsonObject obj;
+    auto put = [&obj](const char* key, qint64 value) {
+        if (value >= 0) {
+            obj[QLatin1String(key)] = static_cast<double>(value);
+        }
+    };
+    put("metadataReadNs", metadataReadNs);
+    put("libraryLoadNs", libraryLoadNs);
+    put("instanceNs", instanceNs);
+    put("providerCreateNs", providerCreateNs);
+    put("interfaceNs", interfaceNs);
+    put("methodsJsonNs", methodsJsonNs);
+    put("loadNs", loadNs());
+    put("fileSize", fileSize);
+    put("metadataBytes", metadataBytes);
+    put("methodCount", methodCount);
+    put("eventCount", eventCount);
+    return obj;
+}
+
+QJsonObject MemoryStats::toJson() const {
+    QJsonObject obj;
+    if (rssDeltaBytes != -1) {
+        obj["rssDeltaBytes"] = static_cast<double>(rssDeltaBytes);
+    }
+    if (mappedBytes >= 0) {
+        obj["mappedBytes"] = static_cast<double>(mappedBytes);
+        QJsonArray objects;
+        for (const SharedObjectInfo& object : newObjects) {
+            QJsonObject entry;
+            entry["path"] = QString::fromStdString(object.path);
+            entry["mappedBytes"] = static_cast<double>(object.mappedBytes);
+            objects.append(entry);
+        }
+        obj["newObjects"] = objects;
+    }
+    obj["interfaceBytes"] = static_cast<double>(interfaceBytes);
+    obj["sharedInterfaceBytes"] = static_cast<double>(sharedInterfaceBytes);
+    obj["metadataBytes"] = static_cast<double>(metadataBytes);
+    return obj;
+}
+
+namespace {
+std::atomic<bool> s_memoryTracking{false};
+
+// Approximate heap held by parsed metadata: string data plus the raw JSON
+qint64 metadataMemoryBytes(const ModuleMetadata& metadata) {
+    qint64 bytes = 0;
+    for (const QString* text : {&metadata.name, &metadata.displayName, &metadata.version,
+                                &metadata.description, &metadata.author, &metadata.type}) {
+        bytes += text->capacity() * static_cast<qint64>(sizeof(QChar));
+    }
+    for (const QString& dependency : metadata.dependencies) {
+        bytes += dependency.capacity() * static_cast<qint64>(sizeof(QChar));
+    }
+    // rawMetadataJson, and rawMetadata whose storage is about the same size
+    bytes += static_cast<qint64>(metadata.rawMetadataJson.capacity()) * 2;
+    return bytes;
+}
+
+// Approximate heap held by a JSON value: Qt keeps array and object members
+// as 16-byte elements next to their string data (UTF-16 at most)
+constexpr std::size_t JsonElementBytes = 16;
+
+std::size_t jsonHeapBytes(const QJsonValue& value) {
+    std::size_t bytes = 0;
+    switch (value.type()) {
+    case QJsonValue::String:
+        bytes = static_cast<std::size_t>(value.toString().size()) * sizeof(QChar);
+        break;
+    case QJsonValue::Array:
+        for (const QJsonValue& element : value.toArray()) {
+            bytes += JsonElementBytes + jsonHeapBytes(element);
+        }
+        break;
+    case QJsonValue::Object: {
+        const QJsonObject object = value.toObject();
+        for (auto it = object.constBegin(); it != object.constEnd(); ++it) {
+            bytes += 2 * JsonElementBytes + static_cast<std::size_t>(it.key().size()) * sizeof(QChar)
+                   + jsonHeapBytes(it.value());
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return bytes;
+}
+
+bool isEventEntry(const QJsonValue& v) {
+    return v.toObject().value(QStringLiteral("type")).toString() == QStringLiteral("event");
+}
+
+MethodInfo methodFromMetaMethod(const QMetaMethod& method, int index) {
+    MethodInfo info;
+    info.metaMethodIndex = index;
+    info.signature = QString::fromUtf8(method.methodSignature());
+    info.name = QString::fromUtf8(method.name());
+    info.returnType = QString::fromUtf8(method.typeName());
+    
+    info.isInvokable = method.isValid() && 
+                      (method.methodType() == QMetaMethod::Method || 
+                       method.methodType() == QMetaMethod::Slot);
+    
+    if (method.parameterCount() > 0) {
+        QByteArrayList paramNames = method.parameterNames();
+        
+        for (int p = 0; p < method.parameterCount(); ++p) {
+            ParameterInfo param;
+            param.type = QString::fromUtf8(method.parameterTypeName(p));
+            
+            if (p < paramNames.size() && !paramNames.at(p).isEmpty()) {
+                param.name = QString::fromUtf8(paramNames.at(p));
+            } else {
+                param.name = "param" + QString::number(p);
+            }
+            
+            info.parameters.push_back(param);
+        }
+    }
+    
+    return info;
+}
+
+// Same layout as MethodInfo::toJson() written through QJsonDocument (keys
+// in QJsonObject's sorted order), without building the QJsonObject.
+void writeMethodView(JsonWriter& writer, const InterfaceTable::MethodView& method) {
+    writer.beginObject();
+    if (!method.description().isEmpty()) {
+        writer.key("description").value(method.description());
+    }
+    writer.key("isInvokable").value(method.isInvokable());
+    writer.key("name").value(method.name());
+    if (method.parameterCount() > 0) {
+        writer.key("parameters").beginArray();
+        for (std::size_t p = 0; p < method.parameterCount(); ++p) {
+            writer.beginObject();
+            writer.key("name").value(method.parameterName(p));
+            writer.key("type").value(method.parameterType(p));
+            writer.endObject();
+        }
+        writer.endArray();
+    }
+    writer.key("returnType").value(method.returnType());
+    writer.key("signature").value(method.signature());
+    writer.endObject();
+}
+
+// Immutable description of one plugin interface. Legacy descriptions depend
+// only on the QMetaObject and are shared process-wide (see
+// metaObjectInterface()); provider descriptions belong to one handle.
+struct InterfaceDescription {
+    InterfaceTable table;
+    bool isProvider = false;
+
+    // Legacy description from metaObjectInterface(), shared by every handle
+    // of the plugin's class
+    bool isShared = false;
+
+    // Provider: its interface entries, verbatim and split by "type"
+    QJsonArray providerMethodsJson;
+    QJsonArray eventsJson;
+
+    // Heap of providerMethodsJson and eventsJson, counted as they are built
+    std::size_t jsonBytes = 0;
+
+    void writeMethods(JsonWriter& writer, bool excludeBaseClass) const {
+        if (isProvider) {
+            writer.value(providerMethodsJson);
+            return;
+        }
+        writer.beginArray();
+        const std::size_t first = excludeBaseClass ? table.ownMethodOffset() : 0;
+        for (std::size_t i = first; i < table.methodCount(); ++i) {
+            writeMethodView(writer, table.method(i));
+        }
+        writer.endArray();
+    }
+
+    const std::string& methodsText(JsonFormat format, bool excludeBaseClass) const {
+        // Providers ignore excludeBaseClass: share one slot
+        const bool own = excludeBaseClass || isProvider;
+        return memoizedText(own ? TextMethods : TextAllMethods, format,
+                            [&](JsonWriter& writer) { writeMethods(writer, own); });
+    }
+
+    // Approximate heap held by the description, including the JSON built so
+    // far. Only reads counters and the memoized text, under their own sync.
+    std::size_t memoryBytes() const {
+        std::size_t bytes = sizeof(*this) + table.memoryBytes() + jsonBytes
+                          + m_methodJsonBytes.load(std::memory_order_acquire);
+        std::lock_guard<std::mutex> lock(m_textMutex);
+        for (const auto& formats : m_text) {
+            for (const std::optional<std::string>& text : formats) {
+                if (text) {
+                    bytes += text->capacity();
+                }
+            }
+        }
+        return bytes;
+    }
+
+    const std::string& eventsText(JsonFormat format) const {
+        return memoizedText(TextEvents, format,
+                            [&](JsonWriter& writer) { writer.value(eventsJson); });
+    }
+
+    std::vector<MethodInfo> methodList(bool excludeBaseClass) const {
+        return table.toMethodInfos(excludeBaseClass);
+    }
+
+    QJsonArray methodJsonList(bool excludeBaseClass) const {
+        if (isProvider) {
+            return providerMethodsJson;
+        }
+        // Legacy JSON is only built for callers that ask for it
+        std::call_once(m_jsonOnce, [this] {
+            std::size_t bytes = 0;
+            for (std::size_t i = 0; i < table.methodCount(); ++i) {
+                QJsonObject json = table.method(i).toJson();
+                // Both arrays share the object: count its data once
+                bytes += JsonElementBytes + jsonHeapBytes(json);
+                if (i >= table.ownMethodOffset()) {
+                    m_methodsJson.append(json);
+                    bytes += JsonElementBytes;
+                }
+                m_allMethodsJson.append(json);
+            }
+            m_methodJsonBytes.store(bytes, std::memory_order_release);
+        });
+        return excludeBaseClass ? m_methodsJson : m_allMethodsJson;
+    }
+
+private:
+    enum TextKind { TextMethods, TextAllMethods, TextEvents, TextKindCount };
+
+    template <typename Write>
+    const std::string& memoizedText(TextKind kind, JsonFormat format, Write write) const {
+        std::lock_guard<std::mutex> lock(m_textMutex);
+        std::optional<std::string>& text = m_text[kind][format == JsonFormat::Compact ? 1 : 0];
+        if (!text) {
+            text.emplace();
+            JsonWriter writer(*text, format);
+            write(writer);
+        }
+        return *text;
+    }
+
+    mutable std::once_flag m_jsonOnce;
+    mutable QJsonArray m_methodsJson;
+    mutable QJsonArray m_allMethodsJson;
+    mutable std::atomic<std::size_t> m_methodJsonBytes{0};  // set once both arrays are built
+
+    // Serialized documents, built on first request and then served as-is
+    mutable std::mutex m_textMutex;
+    mutable std::optional<std::string> m_text[TextKindCount][2];
+};
+
+std::shared_ptr<const InterfaceDescription> describeProvider(LogosProviderObject* provider) {
+    auto description = std::make_shared<InterfaceDescription>();
+    description->isProvider = true;
+    // getMethods() carries the full interface (methods + events); split it
+    // once. An entry with no "type" is a method (pre-events SDK).
+    const QJsonArray interface = provider->getMethods();
+    bool hasEvents = false;
+    for (const QJsonValue& v : interface) {
+        if (isEventEntry(v)) {
+            hasEvents = true;
+            description->eventsJson.append(v);
+        } else {
+            description->providerMethodsJson.append(v);
+            description->table.append(MethodInfo::fromJson(v.toObject()));
+        }
+    }
+    if (!hasEvents) {
+        // Nothing was filtered out: keep the provider's array itself
+        description->providerMethodsJson = interface;
+    }
+    description->jsonBytes = jsonHeapBytes(description->providerMethodsJson)
+                           + jsonHeapBytes(description->eventsJson);
+    description->table.finalize();
+    return description;
+}
+
+// An isolatedFromPath() handle's interface, as its helper reported it. Like
+// a provider's, it lists the plugin's own methods only.
+std::shared_ptr<const InterfaceDescription> describeIsolated(const IsolatedInterface& isolated) {
+    auto description = std::make_shared<InterfaceDescription>();
+    description->isProvider = true;
+    description->providerMethodsJson = isolated.methods;
+    description->eventsJson = isolated.events;
+    for (const QJsonValue& v : isolated.methods) {
+        description->table.append(MethodInfo::fromJson(v.toObject()));
+    }
+    description->jsonBytes = jsonHeapBytes(description->providerMethodsJson)
+                           + jsonHeapBytes(description->eventsJson);
+    description->table.finalize();
+    return description;
+}
+
+std::shared_ptr<const InterfaceDescription> describeMetaObject(const QMetaObject* metaObject) {
+    auto description = std::make_shared<InterfaceDescription>();
+    description->isShared = true;
+    // The class's own methods are those at or past its methodOffset()
+    const int ownOffset = metaObject->methodOffset();
+    for (int i = 0; i < metaObject->methodCount(); ++i) {
+        if (i == ownOffset) {
+            description->table.markOwnMethodsStart();
+        }
+        description->table.append(methodFromMetaMethod(metaObject->method(i), i));
+    }
+    if (ownOffset >= metaObject->methodCount()) {
+        description->table.markOwnMethodsStart();
+    }
+    description->table.finalize();
+    return description;
+}
+
+// Process-wide legacy interface descriptions keyed by QMetaObject. A
+// QMetaObject lives in its plugin's data segment, so entries must be dropped
+// before the plugin is unloaded (LogosModule::unload() does this) or a later
+// library could reuse the address.
+struct MetaObjectRegistry {
+    std::mutex mutex;
+    std::unordered_map<const QMetaObject*, std::shared_ptr<const InterfaceDescription>> entries;
+
+    static MetaObjectRegistry& instance() {
+        static MetaObjectRegistry registry;
+        return registry;
+    }
+};
+
+std::shared_ptr<const InterfaceDescription> metaObjectInterface(const QMetaObject* metaObject) {
+    MetaObjectRegistry& registry = MetaObjectRegistry::instance();
+    {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        auto it = registry.entries.find(metaObject);
+        if (it != registry.entries.end()) {
+            return it->second;
+        }
+    }
+
+    // Describe outside the lock; if another thread raced us, keep its entry
+    auto description = describeMetaObject(metaObject);
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.entries.emplace(metaObject, std::move(description)).first->second;
+}
+
+void forgetMetaObject(const QMetaObject* metaObject) {
+    MetaObjectRegistry& registry = MetaObjectRegistry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.entries.erase(metaObject);
+}
+} // namespace
+
+struct LogosModule::InterfaceCache {
+    // Owned; created once from the plugin and deleted before it is unloaded
+    LogosProviderObject* provider = nullptr;
+    std::shared_ptr<const InterfaceDescription> description;
+
+    InterfaceCache() = default;
+    InterfaceCache(const InterfaceCache&) = delete;
+    InterfaceCache& operator=(const InterfaceCache&) = delete;
+    ~InterfaceCache() { delete provider; }
+};
+
+struct LogosModule::LazyLoad {
+    enum State { Pending, Loaded, Failed };
+
+    QString path;
+    std::once_flag once;
+    std::atomic<int> state{Pending};
+
+    // interfaceCache() of a lazy handle: built once, whichever thread asks first
+    std::once_flag interfaceOnce;
+
+    // Interface served before the load, read on first need
+    std::once_flag sidecarOnce;
+    std::optional<InterfaceSidecar> sidecar;
+
+    // isolatedFromPath(): interface taken by a helper process on first need
+    bool isolated = false;
+    std::once_flag isolatedOnce;
+    std::optional<IsolatedInterface> isolatedInterface;
+};
+
+const LogosModule::InterfaceCache& LogosModule::interfaceCache() const {
+    if (m_lazy) {
+        // The first touch of a lazy handle may come from several threads
+        std::call_once(m_lazy->interfaceOnce, [this]() { m_interface = buildInterfaceCache(); });
+        return *m_interface;
+    }
+    if (!m_interface) {
+        m_interface = buildInterfaceCache();
+    }
+    return *m_interface;
+}
+
+std::unique_ptr<LogosModule::InterfaceCache> LogosModule::buildInterfaceCache() const {
+    auto cache = std::make_unique<InterfaceCache>();
+    QElapsedTimer timer;
+    // An isolated handle is described from its helper's reply, and is never
+    // loaded here for it; a failed helper leaves it invalid and empty
+    if (const IsolatedInterface* isolated = pendingIsolatedInterface()) {
+        timer.start();
+        cache->description = describeIsolated(*isolated);
+        m_stats.interfaceNs = timer.nsecsElapsed();
+        m_stats.methodCount = static_cast<int>(cache->description->table.methodCount());
+        m_stats.eventCount = static_cast<int>(cache->description->eventsJson.size());
+        return cache;
+    }
+    ensureLoaded();
+
+    LogosProviderPlugin* providerPlugin = qobject_cast<LogosProviderPlugin*>(m_instance);
+    if (providerPlugin) {
+        timer.start();
+        cache->provider = providerPlugin->createProviderObject();
+        m_stats.providerCreateNs = timer.nsecsElapsed();
+    }
+
+    timer.start();
+    if (cache->provider) {
+        cache->description = describeProvider(cache->provider);
+    } else if (m_instance) {
+        // Legacy plugin, or a provider plugin that failed to create its provider
+        cache->description = metaObjectInterface(m_instance->metaObject());
+    } else {
+        cache->description = std::make_shared<InterfaceDescription>();
+    }
+    m_stats.interfaceNs = timer.nsecsElapsed();
+
+    const InterfaceTable& table = cache->description->table;
+    m_stats.methodCount = static_cast<int>(table.methodCount() - table.ownMethodOffset());
+    m_stats.eventCount = static_cast<int>(cache->description->eventsJson.size());
+
+    return cache;
+}
+
+void LogosModule::resetInterfaceCache() {
+    m_interface.reset();
+}
+
+void LogosModule::ensureLoaded() const {
+    if (!m_lazy) {
+        return;
+    }
+    std::call_once(m_lazy->once, [this]() {
+        LogosModule loaded = loadFromPath(m_lazy->path);
+        if (!loaded.isValid()) {
+            m_errorString = loaded.m_errorString;
+            m_lazy->state.store(LazyLoad::Failed, std::memory_order_release);
+            return;
+        }
+        m_loader = loaded.m_loader;
+        m_instance = loaded.m_instance;
+        m_stats = loaded.m_stats;
+        m_memory = std::move(loaded.m_memory);
+        loaded.m_loader = nullptr;
+        loaded.m_instance = nullptr;
+        m_lazy->state.store(LazyLoad::Loaded, std::memory_order_release);
+    });
+}
+
 LogosModule::LogosModule() = default;
 
 LogosModule::~LogosModule() {
@@ -45,6 +555,12 @@ LogosModule::LogosModule(LogosModule&& other) noexcept
     , m_metadata(std::move(other.m_metadata))
     , m_errorString(std::move(other.m_errorString))
     , m_isStatic(other.m_isStatic)
+    , m_interface(std::move(other.m_interface))
+    , m_lazy(std::move(other.m_lazy))
+    , m_stats(other.m_stats)
+    , m_memory(std::move(other.m_memory))
+    , m_capturedOutput(std::move(other.m_capturedOutput))
+    , m_shared(std::move(other.m_shared))
 {
     other.m_loader = nullptr;
     other.m_instance = nullptr;
@@ -60,6 +576,12 @@ LogosModule& LogosModule::operator=(LogosModule&& other) noexcept {
         m_metadata = std::move(other.m_metadata);
         m_errorString = std::move(other.m_errorString);
         m_isStatic = other.m_isStatic;
+        m_interface = std::move(other.m_interface);
+        m_lazy = std::move(other.m_lazy);
+        m_stats = other.m_stats;
+        m_memory = std::move(other.m_memory);
+        m_capturedOutput = std::move(other.m_capturedOutput);
+        m_shared = std::move(other.m_shared);
         
         other.m_loader = nullptr;
         other.m_instance = nullptr;
@@ -70,6 +592,18 @@ LogosModule& LogosModule::operator=(LogosModule&& other) noexcept {
 
 LogosModule LogosModule::loadFromPath(const QString& pluginPath, QString* errorString) {
     LogosModule module;
+    LoadStats& stats = module.m_stats;
+
+    const bool trackMemory = isMemoryTracking();
+    std::vector<SharedObjectInfo> objectsBefore;
+    std::int64_t residentBefore = -1;
+    if (trackMemory) {
+        objectsBefore = MemoryUsage::sharedObjects();
+        residentBefore = MemoryUsage::residentBytes();
+    }
+
+    QElapsedTimer timer;
+    timer.start();
     
     module.m_loader = new QPluginLoader(pluginPath);
     
@@ -80,8 +614,37 @@ LogosModule LogosModule::loadFromPath(const QString& pluginPath, QString* errorS
             module.m_metadata = *metadata;
         }
     }
+    stats.metadataReadNs = timer.nsecsElapsed();
+    stats.fileSize = QFileInfo(module.m_loader->fileName()).size();
+    stats.metadataBytes = static_cast<qint64>(module.m_metadata.rawMetadataJson.size());
     
-    module.m_instance = module.m_loader->instance();
+    // load() first so the dlopen and the constructor are timed apart
+    timer.restart();
+    const bool libraryLoaded = module.m_loader->load();
+    stats.libraryLoadNs = timer.nsecsElapsed();
+    if (libraryLoaded) {
+        timer.restart();
+        module.m_instance = module.m_loader->instance();
+        stats.instanceNs = timer.nsecsElapsed();
+    }
+
+    if (trackMemory) {
+        const std::int64_t residentAfter = MemoryUsage::residentBytes();
+        if (residentBefore >= 0 && residentAfter >= 0) {
+            module.m_memory.rssDeltaBytes = residentAfter - residentBefore;
+        }
+        std::unordered_set<std::string> known;
+        for (const SharedObjectInfo& object : objectsBefore) {
+            known.insert(object.path);
+        }
+        module.m_memory.mappedBytes = 0;
+        for (SharedObjectInfo& object : MemoryUsage::sharedObjects()) {
+            if (!known.count(object.path)) {
+                module.m_memory.mappedBytes += static_cast<qint64>(object.mappedBytes);
+                module.m_memory.newObjects.push_back(std::move(object));
+            }
+        }
+    }
     
     if (!module.m_instance) {
         module.m_errorString = module.m_loader->errorString();
@@ -99,6 +662,323 @@ LogosModule LogosModule::loadFromPath(const QString& pluginPath, QString* errorS
     return module;
 }
 
+LogosModule LogosModule::loadFromPath(const QString& pluginPath, const LoadOptions& options,
+                                      QString* errorString) {
+    if (options.output == LoadOptions::Inherit) {
+        return loadFromPath(pluginPath, errorString);
+    }
+
+    OutputCapture capture(options.output == LoadOptions::Capture ? OutputCapture::Capture
+                                                                 : OutputCapture::Discard);
+    LogosModule module = loadFromPath(pluginPath, errorString);
+    module.m_capturedOutput = capture.finish();
+    return module;
+}
+
+LogosModule LogosModule::loadFromPath(const std::string& pluginPath, const LoadOptions& options,
+                                      std::string* errorString) {
+    QString qError;
+    LogosModule result = loadFromPath(QString::fromStdString(pluginPath), options,
+                                      errorString ? &qError : nullptr);
+    if (errorString) {
+        *errorString = qError.toStdString();
+    }
+    return result;
+}
+
+struct LogosModule::SharedLoad : std::enable_shared_from_this<SharedLoad> {
+    QString key;
+    QPluginLoader* loader = nullptr;
+    QObject* instance = nullptr;
+    ModuleMetadata metadata;
+    LoadStats stats;
+    MemoryStats memory;
+
+    // Set by release(): the library must then stay loaded
+    std::atomic<bool> released{false};
+
+    // Canonical path, and each absolute path it was asked for by -> live
+    // shared load; entries expire with their last handle
+    static std::mutex registryMutex;
+    static QHash<QString, std::weak_ptr<SharedLoad>> registry;
+
+    // Registry keys of this load: key, then its aliases (guarded by registryMutex)
+    QStringList keys;
+
+    // Make an absolute path as given find this load without canonicalizing
+    void addAlias(const QString& alias) {
+        if (!alias.isEmpty() && !keys.contains(alias)) {
+            registry.insert(alias, weak_from_this());
+            keys.append(alias);
+        }
+    }
+
+    ~SharedLoad() {
+        {
+            std::lock_guard<std::mutex> lock(registryMutex);
+            for (const QString& registered : keys) {
+                auto it = registry.find(registered);
+                if (it != registry.end() && it->expired()) {
+                    registry.erase(it);
+                }
+            }
+        }
+        if (!released.load(std::memory_order_acquire) && loader) {
+            if (instance) {
+                forgetMetaObject(instance->metaObject());
+            }
+            loader->unload();
+        }
+        delete loader;
+    }
+};
+
+std::mutex LogosModule::SharedLoad::registryMutex;
+QHash<QString, std::weak_ptr<LogosModule::SharedLoad>> LogosModule::SharedLoad::registry;
+
+LogosModule LogosModule::fromShared(const std::shared_ptr<SharedLoad>& shared) {
+    LogosModule module;
+    module.m_shared = shared;
+    module.m_loader = shared->loader;
+    module.m_instance = shared->instance;
+    module.m_metadata = shared->metadata;
+    module.m_stats = shared->stats;
+    module.m_memory = shared->memory;
+    return module;
+}
+
+LogosModule LogosModule::loadShared(const QString& pluginPath, QString* errorString) {
+    // An absolute path is looked up as given first, so reusing a live load is
+    // a hash lookup; only a miss pays for the realpath walk
+    const QString given = QDir::isAbsolutePath(pluginPath) ? QDir::cleanPath(pluginPath) : QString();
+    if (!given.isEmpty()) {
+        std::lock_guard<std::mutex> lock(SharedLoad::registryMutex);
+        if (std::shared_ptr<SharedLoad> shared = SharedLoad::registry.value(given).lock()) {
+            return fromShared(shared);
+        }
+    }
+
+    const QString key = QFileInfo(pluginPath).canonicalFilePath();
+    if (key.isEmpty()) {
+        // Missing file: let loadFromPath() report it
+        return loadFromPath(pluginPath, errorString);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(SharedLoad::registryMutex);
+        if (std::shared_ptr<SharedLoad> shared = SharedLoad::registry.value(key).lock()) {
+            shared->addAlias(given);
+            return fromShared(shared);
+        }
+    }
+
+    // Load outside the lock so unrelated plugins load concurrently
+    LogosModule loaded = loadFromPath(key, errorString);
+    if (!loaded.isValid()) {
+        return loaded;
+    }
+    auto shared = std::make_shared<SharedLoad>();
+    shared->key = key;
+    shared->loader = loaded.m_loader;
+    shared->instance = loaded.m_instance;
+    shared->metadata = std::move(loaded.m_metadata);
+    shared->stats = loaded.m_stats;
+    shared->memory = std::move(loaded.m_memory);
+    loaded.m_loader = nullptr;
+    loaded.m_instance = nullptr;
+
+    std::shared_ptr<SharedLoad> existing;
+    {
+        std::lock_guard<std::mutex> lock(SharedLoad::registryMutex);
+        existing = SharedLoad::registry.value(key).lock();
+        if (existing) {
+            existing->addAlias(given);
+        } else {
+            SharedLoad::registry.insert(key, shared);
+            shared->keys.append(key);
+            shared->addAlias(given);
+        }
+    }
+    if (existing) {
+        // Another thread raced us and won. Qt gives both loaders the same root
+        // instance, so ours must not forget its description: only drop our
+        // library reference.
+        shared->instance = nullptr;
+        shared = std::move(existing);
+    }
+    return fromShared(shared);
+}
+
+LogosModule LogosModule::loadShared(const std::string& pluginPath, std::string* errorString) {
+    QString qError;
+    LogosModule result = loadShared(QString::fromStdString(pluginPath),
+                                    errorString ? &qError : nullptr);
+    if (errorString) {
+        *errorString = qError.toStdString();
+    }
+    return result;
+}
+
+std::size_t LogosModule::sharedLoadCount() {
+    std::lock_guard<std::mutex> lock(SharedLoad::registryMutex);
+    std::size_t count = 0;
+    for (auto it = SharedLoad::registry.constBegin(); it != SharedLoad::registry.constEnd(); ++it) {
+        // Count each load once, by its canonical key, not by its aliases
+        const std::shared_ptr<SharedLoad> shared = it.value().lock();
+        if (shared && shared->key == it.key()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+namespace {
+// Loads run on their own pool so slow plugin constructors never starve
+// QThreadPool::globalInstance() users.
+QThreadPool& loaderThreadPool() {
+    static QThreadPool pool;
+    return pool;
+}
+} // namespace
+
+void LogosModule::moveToThread(QThread* thread) {
+    if (!thread) {
+        return;
+    }
+    if (m_instance && m_instance->thread() != thread) {
+        m_instance->moveToThread(thread);
+    }
+    if (m_loader && m_loader->thread() != thread) {
+        m_loader->moveToThread(thread);
+    }
+}
+
+std::future<LogosModule> LogosModule::loadAsync(const QString& pluginPath, QThread* targetThread) {
+    if (!targetThread) {
+        targetThread = QThread::currentThread();
+    }
+
+    auto promise = std::make_shared<std::promise<LogosModule>>();
+    std::future<LogosModule> future = promise->get_future();
+    loaderThreadPool().start([pluginPath, targetThread, promise]() {
+        LogosModule module = loadFromPath(pluginPath);
+        module.moveToThread(targetThread);
+        promise->set_value(std::move(module));
+    });
+    return future;
+}
+
+std::future<LogosModule> LogosModule::loadAsync(const std::string& pluginPath, QThread* targetThread) {
+    return loadAsync(QString::fromStdString(pluginPath), targetThread);
+}
+
+const InterfaceSidecar* LogosModule::pendingSidecar() const {
+    if (!m_lazy || m_lazy->state.load(std::memory_order_acquire) != LazyLoad::Pending) {
+        return nullptr;
+    }
+    std::call_once(m_lazy->sidecarOnce, [this]() {
+        m_lazy->sidecar = InterfaceSidecar::read(m_lazy->path);
+    });
+    return m_lazy->sidecar ? &*m_lazy->sidecar : nullptr;
+}
+
+const IsolatedInterface* LogosModule::pendingIsolatedInterface() const {
+    if (!m_lazy || !m_lazy->isolated
+        || m_lazy->state.load(std::memory_order_acquire) != LazyLoad::Pending) {
+        return nullptr;
+    }
+    std::call_once(m_lazy->isolatedOnce, [this]() {
+        QString error;
+        m_lazy->isolatedInterface = IsolatedIntrospection::introspect(
+            m_lazy->path, IsolatedIntrospection::DefaultTimeoutMs, &error);
+        if (!m_lazy->isolatedInterface) {
+            // Contained: never load in-process what the helper could not
+            std::call_once(m_lazy->once, [this, &error]() {
+                m_errorString = error;
+                m_lazy->state.store(LazyLoad::Failed, std::memory_order_release);
+            });
+        }
+    });
+    return m_lazy->isolatedInterface ? &*m_lazy->isolatedInterface : nullptr;
+}
+
+LogosModule LogosModule::lazyFromPath(const QString& pluginPath, QString* errorString) {
+    LogosModule module;
+
+    std::optional<ModuleMetadata> metadata = extractMetadata(pluginPath);
+    if (!metadata) {
+        module.m_errorString = QStringLiteral("No plugin metadata found in %1").arg(pluginPath);
+        if (errorString) {
+            *errorString = module.m_errorString;
+        }
+        qWarning() << "LogosModule:" << module.m_errorString;
+        return module;
+    }
+
+    module.m_metadata = std::move(*metadata);
+    module.m_lazy = std::make_unique<LazyLoad>();
+    module.m_lazy->path = pluginPath;
+    return module;
+}
+
+LogosModule LogosModule::isolatedFromPath(const QString& pluginPath, QString* errorString) {
+    LogosModule module = lazyFromPath(pluginPath, errorString);
+    if (module.m_lazy) {
+        module.m_lazy->isolated = true;
+    }
+    return module;
+}
+
+LogosModule LogosModule::isolatedFromPath(const std::string& pluginPath, std::string* errorString) {
+    QString qError;
+    LogosModule result = isolatedFromPath(QString::fromStdString(pluginPath),
+                                          errorString ? &qError : nullptr);
+    if (errorString) {
+        *errorString = qError.toStdString();
+    }
+    return result;
+}
+
+LogosModule LogosModule::lazyFromPath(const std::string& pluginPath, std::string* errorString) {
+    QString qError;
+    LogosModule result = lazyFromPath(QString::fromStdString(pluginPath),
+                                      errorString ? &qError : nullptr);
+    if (errorString) {
+        *errorString = qError.toStdString();
+    }
+    return result;
+}
+
+void LogosModule::loadAsync(const QString& pluginPath, QObject* context,
+                            std::function<void(LogosModule)> onLoaded) {
+    if (!context || !onLoaded) {
+        qWarning() << "LogosModule: loadAsync needs a context object and a callback";
+        return;
+    }
+
+    QPointer<QObject> guard(context);
+    QThread* targetThread = context->thread();
+
+    // Results are posted to a relay living in the context's thread rather
+    // than to the context itself, which the loader thread must not touch:
+    // the relay checks the guard where the context lives, then goes away.
+    auto* relay = new QObject;
+    relay->moveToThread(targetThread);
+
+    loaderThreadPool().start([pluginPath, guard, targetThread, relay,
+                              onLoaded = std::move(onLoaded)]() {
+        // Shared so the queued functor stays copyable
+        auto module = std::make_shared<LogosModule>(loadFromPath(pluginPath));
+        module->moveToThread(targetThread);
+        QMetaObject::invokeMethod(relay, [relay, guard, module, onLoaded]() {
+            if (guard) {
+                onLoaded(std::move(*module));
+            }
+            relay->deleteLater();
+        }, Qt::QueuedConnection);
+    });
+}
+
 std::vector<LogosModule> LogosModule::getStaticModules() {
     std::vector<LogosModule> modules;
     
@@ -137,35 +1017,52 @@ LogosModule LogosModule::wrapExisting(QObject* pluginObject, const ModuleMetadat
 }
 
 std::optional<ModuleMetadata> LogosModule::extractMetadata(const QString& pluginPath) {
-    return ModuleMetadata::fromPath(pluginPath);
+    MetadataCache& cache = MetadataCache::global();
+    if (cache.isEnabled()) {
+        return cache.get(pluginPath);
+    }
+    return MetadataIndex::findOrRead(pluginPath);
+}
+
+namespace {
+QString pathFromView(std::string_view pluginPath) {
+    return QString::fromUtf8(pluginPath.data(), static_cast<qsizetype>(pluginPath.size()));
 }
+} // namespace
 
-std::string LogosModule::getModuleName(const std::string& pluginPath) {
-    auto metadata = extractMetadata(QString::fromStdString(pluginPath));
+std::optional<MetadataView> LogosModule::getMetadataView(std::string_view pluginPath) {
+    auto metadata = extractMetadata(pathFromView(pluginPath));
     if (!metadata || !metadata->isValid()) {
-        return {};
+        return std::nullopt;
     }
-    return metadata->name.toStdString();
+    return metadata->view();
 }
 
-std::string LogosModule::getRawMetadataJson(const std::string& pluginPath) {
-    auto metadata = extractMetadata(QString::fromStdString(pluginPath));
+// The single-field helpers copy out only what they return, not a whole view
+std::string LogosModule::getModuleName(std::string_view pluginPath) {
+    auto metadata = extractMetadata(pathFromView(pluginPath));
+    return metadata ? metadata->name.toStdString() : std::string();
+}
+
+std::string LogosModule::getRawMetadataJson(std::string_view pluginPath) {
+    auto metadata = extractMetadata(pathFromView(pluginPath));
     if (!metadata || !metadata->isValid()) {
-        return {};
+        return std::string();
     }
-    return metadata->rawMetadataJson;
+    return std::move(metadata->rawMetadataJson);
 }
 
-std::vector<std::string> LogosModule::getModuleDependencies(const std::string& pluginPath) {
-    auto metadata = extractMetadata(QString::fromStdString(pluginPath));
-    if (!metadata) {
-        return {};
+std::vector<std::string> LogosModule::getModuleDependencies(std::string_view pluginPath) {
+    std::vector<std::string> dependencies;
+    auto metadata = extractMetadata(pathFromView(pluginPath));
+    if (!metadata || !metadata->isValid()) {
+        return dependencies;
     }
-    std::vector<std::string> result;
-    for (const QString& dep : metadata->dependencies) {
-        result.push_back(dep.toStdString());
+    dependencies.reserve(static_cast<std::size_t>(metadata->dependencies.size()));
+    for (const QString& dependency : metadata->dependencies) {
+        dependencies.push_back(dependency.toStdString());
     }
-    return result;
+    return dependencies;
 }
 
 LogosModule LogosModule::loadFromPath(const std::string& pluginPath, std::string* errorString) {
@@ -186,10 +1083,25 @@ bool LogosModule::hasMethod(const std::string& methodName) const {
 }
 
 bool LogosModule::isValid() const {
+    if (m_lazy) {
+        return m_lazy->state.load(std::memory_order_acquire) != LazyLoad::Failed;
+    }
     return m_instance != nullptr;
 }
 
+bool LogosModule::isLoaded() const {
+    if (m_lazy) {
+        return m_lazy->state.load(std::memory_order_acquire) == LazyLoad::Loaded;
+    }
+    return m_instance != nullptr;
+}
+
+bool LogosModule::isShared() const {
+    return m_shared != nullptr;
+}
+
 QObject* LogosModule::instance() const {
+    ensureLoaded();
     return m_instance;
 }
 
@@ -201,43 +1113,212 @@ QString LogosModule::errorString() const {
     return m_errorString;
 }
 
+const QByteArray& LogosModule::capturedOutput() const {
+    return m_capturedOutput;
+}
+
+const LoadStats& LogosModule::loadStats() const {
+    return m_stats;
+}
+
+MemoryStats LogosModule::memoryStats() const {
+    MemoryStats stats = m_memory;
+    if (m_interface && m_interface->description) {
+        const InterfaceDescription& description = *m_interface->description;
+        const qint64 bytes = static_cast<qint64>(description.memoryBytes());
+        (description.isShared ? stats.sharedInterfaceBytes : stats.interfaceBytes) = bytes;
+    }
+    stats.metadataBytes = metadataMemoryBytes(m_metadata);
+    return stats;
+}
+
+void LogosModule::setMemoryTracking(bool enabled) {
+    s_memoryTracking.store(enabled, std::memory_order_relaxed);
+}
+
+bool LogosModule::isMemoryTracking() {
+    return s_memoryTracking.load(std::memory_order_relaxed);
+}
+
 void LogosModule::unload() {
-    if (m_loader && !m_isStatic) {
+    // The provider's code lives in the plugin: delete it before unloading,
+    // and drop the shared description keyed by the plugin's QMetaObject.
+    resetInterfaceCache();
+    if (m_shared) {
+        m_shared.reset();
+    } else if (m_loader && !m_isStatic) {
+        if (m_instance) {
+            forgetMetaObject(m_instance->metaObject());
+        }
         m_loader->unload();
         delete m_loader;
     }
     m_loader = nullptr;
     m_instance = nullptr;
+    m_lazy.reset();
+}
+
+bool LogosModule::reload(QString* errorString) {
+    const QString path = pluginPath();
+    if (path.isEmpty()) {
+        m_errorString = QStringLiteral("Plugin has no file to reload from");
+        if (errorString) {
+            *errorString = m_errorString;
+        }
+        return false;
+    }
+
+    const bool lazy = m_lazy && m_lazy->state.load(std::memory_order_acquire) == LazyLoad::Pending;
+    const bool isolated = lazy && m_lazy->isolated;
+    const bool shared = isShared();
+    unload();
+    if (lazy) {
+        *this = isolated ? isolatedFromPath(path, errorString) : lazyFromPath(path, errorString);
+    } else {
+        *this = shared ? loadShared(path, errorString) : loadFromPath(path, errorString);
+    }
+    return isValid();
+}
+
+bool LogosModule::reload(std::string* errorString) {
+    QString qError;
+    const bool reloaded = reload(errorString ? &qError : nullptr);
+    if (errorString) {
+        *errorString = qError.toStdString();
+    }
+    return reloaded;
+}
+
+QString LogosModule::pluginPath() const {
+    if (m_lazy) {
+        return m_lazy->path;
+    }
+    if (m_loader && !m_isStatic) {
+        return m_loader->fileName();
+    }
+    return QString();
 }
 
 QObject* LogosModule::release() {
-    QObject* instance = m_instance;
+    QObject* instance = this->instance();
+    
+    resetInterfaceCache();
+    if (m_shared) {
+        m_shared->released.store(true, std::memory_order_release);
+        m_shared.reset();
+    }
     
     m_loader = nullptr;
     m_instance = nullptr;
+    m_lazy.reset();
     m_isStatic = true;
     
     return instance;
 }
 
 std::vector<MethodInfo> LogosModule::getMethods(bool excludeBaseClass) const {
-    return getMethods(m_instance, excludeBaseClass);
+    return interfaceCache().description->methodList(excludeBaseClass);
 }
 
 QJsonArray LogosModule::getMethodsAsJson(bool excludeBaseClass) const {
-    return getMethodsAsJson(m_instance, excludeBaseClass);
+    // The sidecar lists the plugin's own methods only
+    if (excludeBaseClass) {
+        if (const InterfaceSidecar* sidecar = pendingSidecar()) {
+            return sidecar->methods();
+        }
+        if (const IsolatedInterface* isolated = pendingIsolatedInterface()) {
+            return isolated->methods;
+        }
+    }
+    const InterfaceDescription& description = *interfaceCache().description;
+    if (m_stats.methodsJsonNs >= 0) {
+        return description.methodJsonList(excludeBaseClass);
+    }
+    QElapsedTimer timer;
+    timer.start();
+    QJsonArray methods = description.methodJsonList(excludeBaseClass);
+    m_stats.methodsJsonNs = timer.nsecsElapsed();
+    return methods;
 }
 
 QJsonArray LogosModule::getEventsAsJson() const {
-    return getEventsAsJson(m_instance);
+    if (const InterfaceSidecar* sidecar = pendingSidecar()) {
+        return sidecar->events();
+    }
+    if (const IsolatedInterface* isolated = pendingIsolatedInterface()) {
+        return isolated->events;
+    }
+    return interfaceCache().description->eventsJson;
+}
+
+void LogosModule::writeMethodsJson(JsonWriter& writer, bool excludeBaseClass) const {
+    const InterfaceDescription& description = *interfaceCache().description;
+    QElapsedTimer timer;
+    timer.start();
+    description.writeMethods(writer, excludeBaseClass);
+    if (m_stats.methodsJsonNs < 0) {
+        m_stats.methodsJsonNs = timer.nsecsElapsed();
+    }
+}
+
+void LogosModule::writeEventsJson(JsonWriter& writer) const {
+    writer.value(interfaceCache().description->eventsJson);
+}
+
+const std::string& LogosModule::methodsJsonText(JsonFormat format, bool excludeBaseClass) const {
+    const InterfaceDescription& description = *interfaceCache().description;
+    QElapsedTimer timer;
+    timer.start();
+    const std::string& text = description.methodsText(format, excludeBaseClass);
+    if (m_stats.methodsJsonNs < 0) {
+        m_stats.methodsJsonNs = timer.nsecsElapsed();
+    }
+    return text;
+}
+
+const std::string& LogosModule::eventsJsonText(JsonFormat format) const {
+    return interfaceCache().description->eventsText(format);
+}
+
+const InterfaceTable& LogosModule::interfaceTable() const {
+    return interfaceCache().description->table;
 }
 
 QString LogosModule::getClassName() const {
-    return getClassName(m_instance);
+    return getClassName(instance());
 }
 
 bool LogosModule::hasMethod(const QString& methodName) const {
-    return hasMethod(m_instance, methodName);
+    if (!isValid()) {
+        return false;
+    }
+    return interfaceTable().indexOfName(methodName).has_value();
+}
+
+std::optional<MethodInfo> LogosModule::findMethod(const QString& nameOrSignature) const {
+    if (!isValid()) {
+        return std::nullopt;
+    }
+    const InterfaceTable& table = interfaceTable();
+
+    std::optional<std::size_t> index = table.indexOfName(nameOrSignature);
+    if (!index && nameOrSignature.contains(QLatin1Char('('))) {
+        index = table.indexOfSignature(nameOrSignature);
+    }
+    if (!index) {
+        return std::nullopt;
+    }
+    return table.method(*index).toMethodInfo();
+}
+
+std::optional<MethodInfo> LogosModule::findMethod(const std::string& nameOrSignature) const {
+    return findMethod(QString::fromStdString(nameOrSignature));
+}
+
+void LogosModule::clearIntrospectionCache() {
+    MetaObjectRegistry& registry = MetaObjectRegistry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.entries.clear();
 }
 
 std::vector<MethodInfo> LogosModule::getMethods(QObject* obj, bool excludeBaseClass) {
@@ -255,71 +1336,18 @@ std::vector<MethodInfo> LogosModule::getMethods(QObject* obj, bool excludeBaseCl
         if (provider) {
             QJsonArray jsonMethods = provider->getMethods();
             for (const QJsonValue& v : jsonMethods) {
-                QJsonObject mo = v.toObject();
                 // getMethods() carries the full interface (methods + events);
                 // this MethodInfo path is methods-only, so skip event entries.
-                if (mo.value(QStringLiteral("type")).toString() == QStringLiteral("event"))
+                if (isEventEntry(v))
                     continue;
-                MethodInfo info;
-                info.name = mo["name"].toString();
-                info.signature = mo["signature"].toString();
-                info.returnType = mo["returnType"].toString();
-                info.isInvokable = mo["isInvokable"].toBool(true);
-                info.description = mo["description"].toString();
-                QJsonArray params = mo["parameters"].toArray();
-                for (const QJsonValue& pv : params) {
-                    QJsonObject po = pv.toObject();
-                    ParameterInfo param;
-                    param.name = po["name"].toString();
-                    param.type = po["type"].toString();
-                    info.parameters.push_back(param);
-                }
-                methods.push_back(info);
+                methods.push_back(MethodInfo::fromJson(v.toObject()));
             }
             delete provider;
             return methods;
         }
     }
 
-    const QMetaObject* metaObject = obj->metaObject();
-    
-    for (int i = 0; i < metaObject->methodCount(); ++i) {
-        QMetaMethod method = metaObject->method(i);
-        
-        if (excludeBaseClass && method.enclosingMetaObject() != metaObject) {
-            continue;
-        }
-        
-        MethodInfo info;
-        info.signature = QString::fromUtf8(method.methodSignature());
-        info.name = QString::fromUtf8(method.name());
-        info.returnType = QString::fromUtf8(method.typeName());
-        
-        info.isInvokable = method.isValid() && 
-                          (method.methodType() == QMetaMethod::Method || 
-                           method.methodType() == QMetaMethod::Slot);
-        
-        if (method.parameterCount() > 0) {
-            QByteArrayList paramNames = method.parameterNames();
-            
-            for (int p = 0; p < method.parameterCount(); ++p) {
-                ParameterInfo param;
-                param.type = QString::fromUtf8(method.parameterTypeName(p));
-                
-                if (p < paramNames.size() && !paramNames.at(p).isEmpty()) {
-                    param.name = QString::fromUtf8(paramNames.at(p));
-                } else {
-                    param.name = "param" + QString::number(p);
-                }
-                
-                info.parameters.push_back(param);
-            }
-        }
-        
-        methods.push_back(info);
-    }
-    
-    return methods;
+    return metaObjectInterface(obj->metaObject())->methodList(excludeBaseClass);
 }
 
 namespace {
@@ -328,11 +1356,20 @@ namespace {
 // entry with no "type" is treated as a method, so plugins built against the
 // pre-events SDK (whose getMethods() carries no events) degrade cleanly.
 QJsonArray filterInterfaceByType(const QJsonArray& interface, bool keepEvents) {
+    bool allKept = true;
+    for (const QJsonValue& v : interface) {
+        if (isEventEntry(v) != keepEvents) {
+            allKept = false;
+            break;
+        }
+    }
+    if (allKept) {
+        return interface;
+    }
+
     QJsonArray out;
     for (const QJsonValue& v : interface) {
-        const bool isEvent =
-            v.toObject().value(QStringLiteral("type")).toString() == QStringLiteral("event");
-        if (isEvent == keepEvents) out.append(v);
+        if (isEventEntry(v) == keepEvents) out.append(v);
     }
     return out;
 }
@@ -352,14 +1389,12 @@ QJsonArray LogosModule::getMethodsAsJson(QObject* obj, bool excludeBaseClass) {
         }
     }
 
-    QJsonArray methodsArray;
-
-    auto methods = getMethods(obj, excludeBaseClass);
-    for (const auto& method : methods) {
-        methodsArray.append(method.toJson());
+    if (!obj) {
+        qWarning() << "LogosModule: Null object for introspection";
+        return QJsonArray();
     }
 
-    return methodsArray;
+    return metaObjectInterface(obj->metaObject())->methodJsonList(excludeBaseClass);
 }
 
 QJsonArray LogosModule::getEventsAsJson(QObject* obj) {
@@ -391,14 +1426,26 @@ bool LogosModule::hasMethod(QObject* obj, const QString& methodName) {
         return false;
     }
     
-    auto methods = getMethods(obj, false);
-    for (const auto& method : methods) {
-        if (method.name == methodName) {
-            return true;
+    // New-API plugins answer from their provider's interface
+    LogosProviderPlugin* providerPlugin = qobject_cast<LogosProviderPlugin*>(obj);
+    if (providerPlugin) {
+        LogosProviderObject* provider = providerPlugin->createProviderObject();
+        if (provider) {
+            bool found = false;
+            const QJsonArray interface = provider->getMethods();
+            for (const QJsonValue& v : interface) {
+                if (!isEventEntry(v) &&
+                    v.toObject().value(QStringLiteral("name")).toString() == methodName) {
+                    found = true;
+                    break;
+                }
+            }
+            delete provider;
+            return found;
         }
     }
     
-    return false;
+    return metaObjectInterface(obj->metaObject())->table.indexOfName(methodName).has_value();
 }
 
 } // namespace ModuleLib
@@ -1,20 +1,32 @@
 #ifndef LOGOS_MODULE_H
 #define LOGOS_MODULE_H
 
+#include "interface_table.h"
+#include "json_writer.h"
+#include "memory_usage.h"
 #include "module_metadata.h"
+#include <QByteArray>
 #include <QString>
 #include <QStringList>
 #include <QJsonArray>
 #include <QJsonObject>
 #include <QObject>
 #include <QPluginLoader>
+#include <functional>
+#include <future>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <optional>
 
+class QThread;
+
 namespace ModuleLib {
 
+class InterfaceSidecar;
+struct IsolatedInterface;
+
 /**
  * @brief ParameterInfo represents information about a method parameter.
  */
@@ -35,10 +47,94 @@ struct MethodInfo {
     bool isInvokable = false;
     QString description;
     std::vector<ParameterInfo> parameters;
+    /// QMetaObject method index for direct dispatch (legacy plugins); -1 for provider methods
+    int metaMethodIndex = -1;
+
+    QJsonObject toJson() const;
+
+    /**
+     * @brief Parse one method entry as written by toJson() or a provider's getMethods().
+     */
+    static MethodInfo fromJson(const QJsonObject& json);
+};
+
+/**
+ * @brief LoadStats records how long each phase of loading and introspecting
+ *        one plugin took, and how large its inputs were.
+ *
+ * Durations are monotonic (QElapsedTimer) in nanoseconds; -1 means the phase
+ * has not run for this handle. The load phases are measured by
+ * loadFromPath() (and by the deferred load of a lazyFromPath() handle), the
+ * interface phases by the first introspection call that needs them. Legacy
+ * interfaces are shared by every handle of a class, so when another handle
+ * already described the class, interfaceNs is only the cache lookup.
+ */
+struct LoadStats {
+    qint64 metadataReadNs = -1;    ///< Locating the file and reading + parsing its embedded metadata
+    qint64 libraryLoadNs = -1;     ///< dlopen and static initializers (QPluginLoader::load())
+    qint64 instanceNs = -1;        ///< The plugin constructor (QPluginLoader::instance())
+    qint64 providerCreateNs = -1;  ///< createProviderObject() (new-API plugins only)
+    qint64 interfaceNs = -1;       ///< Describing the interface: provider getMethods() + split, or the QMetaObject walk
+    qint64 methodsJsonNs = -1;     ///< First serialization of the methods to JSON
+
+    qint64 fileSize = -1;          ///< Size of the plugin file in bytes
+    qint64 metadataBytes = -1;     ///< Size of the raw metadata as compact JSON
+    int methodCount = -1;          ///< The plugin's own methods
+    int eventCount = -1;
+
+    /**
+     * @brief Sum of the load phases that ran (metadata read, library load, constructor).
+     */
+    qint64 loadNs() const;
+
+    /**
+     * @brief The stats as a JSON object, keyed by field name; phases that did not run are omitted.
+     */
+    QJsonObject toJson() const;
+};
+
+/**
+ * @brief MemoryStats is what one loaded plugin costs the process.
+ *
+ * The load-time fields are measured by loadFromPath() while memory tracking
+ * is enabled (LogosModule::setMemoryTracking()) and are -1 otherwise: the
+ * shared objects the load mapped (the plugin and any dependencies not
+ * already loaded), and the change in resident set size across the load,
+ * which includes the plugin's static initializers and constructor. Loads
+ * running concurrently on other threads are counted in each other's RSS
+ * delta. The heap estimates are computed when memoryStats() is called,
+ * from counters kept while the interface was built. A legacy interface
+ * description is shared by every handle of its class, so it is reported in
+ * sharedInterfaceBytes rather than interfaceBytes.
+ */
+struct MemoryStats {
+    qint64 rssDeltaBytes = -1;                   ///< Resident set change across the load
+    qint64 mappedBytes = -1;                     ///< Sum of newObjects' mapped sizes
+    std::vector<SharedObjectInfo> newObjects;    ///< Shared objects first mapped by the load
+    qint64 interfaceBytes = 0;                   ///< Approximate heap held by this handle's own cached interface
+    qint64 sharedInterfaceBytes = 0;             ///< Approximate heap of the shared legacy description it uses
+    qint64 metadataBytes = 0;                    ///< Approximate heap held by the parsed metadata
 
+    /**
+     * @brief The stats as a JSON object; load-time fields that were not measured are omitted.
+     */
     QJsonObject toJson() const;
 };
 
+/**
+ * @brief Options of LogosModule::loadFromPath().
+ */
+struct LoadOptions {
+    /// What happens to output the plugin writes to stdout/stderr while it loads
+    enum Output {
+        Inherit,   ///< Leave the process's stdout/stderr alone
+        Discard,   ///< Drop it (see OutputCapture)
+        Capture    ///< Keep it for LogosModule::capturedOutput()
+    };
+
+    Output output = Inherit;
+};
+
 /**
  * @brief LogosModule is an RAII wrapper for a loaded plugin with introspection capabilities.
  * 
@@ -98,6 +194,170 @@ public:
      * @return LogosModule Handle to the loaded plugin (check isValid())
      */
     static LogosModule loadFromPath(const std::string& pluginPath, std::string* errorString = nullptr);
+
+    /**
+     * @brief Load a plugin from a file path with options.
+     * 
+     * With LoadOptions::Discard or LoadOptions::Capture, what the plugin's
+     * static initializers and constructor print is redirected by an
+     * OutputCapture for the duration of the load, together with the load's
+     * own warnings; errorString still reports a failure.
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param options How to load the plugin
+     * @param errorString Optional pointer to receive error message on failure
+     * @return LogosModule Handle to the loaded plugin (check isValid())
+     */
+    static LogosModule loadFromPath(const QString& pluginPath, const LoadOptions& options,
+                                    QString* errorString = nullptr);
+
+    /**
+     * @brief Load a plugin from a file path with options (std::string overload).
+     */
+    static LogosModule loadFromPath(const std::string& pluginPath, const LoadOptions& options,
+                                    std::string* errorString = nullptr);
+
+    /**
+     * @brief Get a handle to a plugin shared by every loadShared() caller.
+     * 
+     * Shared loads are kept in a process-wide registry keyed by the plugin's
+     * canonical path, and by each absolute path it was requested by. The
+     * first call loads the plugin as loadFromPath() does; while any handle
+     * to it is alive, later calls for the same file return a handle to the
+     * same loader and instance. A repeated absolute path is a hash lookup
+     * with no filesystem access; other paths are canonicalized first. The
+     * plugin is unloaded when the last of these handles is unloaded or
+     * destroyed. Each handle keeps its own interface cache and metadata copy.
+     * 
+     * The instance lives in the thread of the first caller. A plugin rebuilt,
+     * or a symlink to it repointed, while handles to it are alive is only
+     * picked up once they are all gone.
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param errorString Optional pointer to receive error message on failure
+     * @return LogosModule Shared handle to the loaded plugin (check isValid())
+     */
+    static LogosModule loadShared(const QString& pluginPath, QString* errorString = nullptr);
+
+    /**
+     * @brief Get a shared handle to a plugin (std::string overload).
+     */
+    static LogosModule loadShared(const std::string& pluginPath, std::string* errorString = nullptr);
+
+    /**
+     * @brief Number of plugins currently loaded through loadShared().
+     */
+    static std::size_t sharedLoadCount();
+
+    /**
+     * @brief Load a plugin on a loader thread without blocking the caller.
+     * 
+     * The file I/O, dlopen, static initializers and plugin constructor run on
+     * a dedicated loader thread pool, so several modules can load in
+     * parallel. Before the handle is delivered, the plugin instance (and its
+     * loader) is moved to @p targetThread, so it receives events and queued
+     * calls there. On failure the handle is invalid; see errorString().
+     * 
+     * Example usage:
+     * @code
+     * std::vector<std::future<LogosModule>> pending;
+     * for (const QString& path : paths)
+     *     pending.push_back(LogosModule::loadAsync(path));
+     * for (auto& future : pending) {
+     *     LogosModule plugin = future.get();
+     *     // ...
+     * }
+     * @endcode
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param targetThread Thread the instance should live in (default: the calling thread)
+     * @return std::future<LogosModule> Becomes ready once loading has finished
+     */
+    static std::future<LogosModule> loadAsync(const QString& pluginPath, QThread* targetThread = nullptr);
+
+
+    /**
+     * @brief Create a handle whose plugin is loaded on first use.
+     * 
+     * Only the metadata is read now, without loading the plugin (see
+     * extractMetadata()); metadata() is available immediately. The dlopen and
+     * plugin construction are deferred until the first call that needs the
+     * instance: instance(), as<T>(), release() or any introspection call.
+     * That first touch is thread-safe: concurrent callers wait for a single
+     * load, and the instance lives in the thread that triggered it. If the
+     * deferred load fails, isValid() turns false and errorString() says why.
+     * 
+     * Until then, getMethodsAsJson() and getEventsAsJson() are served from
+     * the plugin's InterfaceSidecar when it has a valid one, without loading.
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param errorString Optional pointer to receive error message if the metadata cannot be read
+     * @return LogosModule Handle to the not yet loaded plugin (check isValid())
+     */
+    static LogosModule lazyFromPath(const QString& pluginPath, QString* errorString = nullptr);
+
+    /**
+     * @brief Create a handle whose plugin is loaded on first use (std::string overload).
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param errorString Optional pointer to receive error message if the metadata cannot be read
+     * @return LogosModule Handle to the not yet loaded plugin (check isValid())
+     */
+    static LogosModule lazyFromPath(const std::string& pluginPath, std::string* errorString = nullptr);
+
+    /**
+     * @brief Create a lazy handle whose interface is taken out of process.
+     * 
+     * Like lazyFromPath(), but the introspection calls (getMethods(),
+     * getMethodsAsJson(), getEventsAsJson(), hasMethod(), findMethod() and
+     * the JSON writers) are answered, while the plugin is not loaded, by
+     * IsolatedIntrospection: a helper process loads the plugin and reports
+     * its interface, and the result is cached per FileIdentity, so the
+     * plugin's code never runs in this process and an unchanged plugin is
+     * only introspected once. A matching InterfaceSidecar is still
+     * preferred. The helper reports the plugin's own methods only, so
+     * excludeBaseClass has no effect and MethodInfo::metaMethodIndex is -1.
+     * If the helper fails (the plugin crashes, hangs or cannot be loaded),
+     * the handle turns invalid with errorString() set, those calls return
+     * empty results, and the plugin is never loaded here. Only instance(),
+     * getClassName() and release(), which need the object itself, load it
+     * in-process as for lazyFromPath().
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param errorString Optional pointer to receive error message if the metadata cannot be read
+     * @return LogosModule Handle to the not yet loaded plugin (check isValid())
+     */
+    static LogosModule isolatedFromPath(const QString& pluginPath, QString* errorString = nullptr);
+
+    /**
+     * @brief Create a lazy handle with out-of-process introspection (std::string overload).
+     */
+    static LogosModule isolatedFromPath(const std::string& pluginPath, std::string* errorString = nullptr);
+
+    /**
+     * @brief Load a plugin on a loader thread (std::string overload).
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param targetThread Thread the instance should live in (default: the calling thread)
+     * @return std::future<LogosModule> Becomes ready once loading has finished
+     */
+    static std::future<LogosModule> loadAsync(const std::string& pluginPath, QThread* targetThread = nullptr);
+
+    /**
+     * @brief Load a plugin on a loader thread and deliver it to a callback.
+     * 
+     * @p onLoaded is invoked through @p context's event loop (a queued call
+     * in @p context's thread, which is also where the instance is moved), so
+     * it never runs concurrently with that thread's other work. If @p context
+     * is destroyed first, the callback is dropped and the plugin unloaded.
+     * The context's thread must keep running its event loop until then.
+     * 
+     * @param pluginPath Path to the plugin file (.so, .dylib, .dll)
+     * @param context Receiver whose thread runs the callback and owns the instance
+     * @param onLoaded Called with the handle (check isValid())
+     */
+    static void loadAsync(const QString& pluginPath, QObject* context,
+                          std::function<void(LogosModule)> onLoaded);
     
     /**
      * @brief Get all statically linked plugins.
@@ -120,6 +380,9 @@ public:
     /**
      * @brief Extract metadata from a plugin file without loading it.
      * 
+     * Consults the plugin directory's MetadataIndex first, and is served from
+     * MetadataCache::global() when that cache is enabled.
+     * 
      * @param pluginPath Path to the plugin file
      * @return std::optional<ModuleMetadata> The metadata if extraction succeeded
      */
@@ -133,20 +396,34 @@ public:
      */
     static std::optional<ModuleMetadata> extractMetadata(const std::string& pluginPath);
     
+    /**
+     * @brief Read a plugin file once and return a Qt-free snapshot of its identity.
+     *
+     * Prefer this over calling getModuleName / getModuleDependencies /
+     * getRawMetadataJson one after another: those helpers are views over the
+     * same snapshot, and each of them re-reads the plugin file (though each
+     * only copies out the field it returns).
+     *
+     * @param pluginPath Path to the plugin file
+     * @return std::optional<MetadataView> The snapshot if extraction succeeded
+     */
+    static std::optional<MetadataView> getMetadataView(std::string_view pluginPath);
+
     /**
      * @brief Get just the module name from a plugin file without loading it.
      * 
      * @param pluginPath Path to the plugin file
      * @return std::string The module name, or empty string if extraction failed
      */
-    static std::string getModuleName(const std::string& pluginPath);
+    static std::string getModuleName(std::string_view pluginPath);
 
     /**
      * @brief Get the full raw metadata of a plugin as a compact JSON string,
      *        without loading it.
      *
-     * Reads the embedded "MetaData" object via QPluginLoader::metaData() (no
-     * plugin instantiation) and returns it serialized as compact JSON. This is
+     * Reads the embedded "MetaData" object (no plugin instantiation) and
+     * returns it as compact JSON, the same text as
+     * loadFromPath(path).metadata().rawMetadataJson. This is
      * the declarative metadata.json content (name, version, type, description,
      * dependencies, author, logos_protocol_version, …) — it does NOT include
      * methods/events, which are only available once the plugin is instantiated.
@@ -154,7 +431,7 @@ public:
      * @param pluginPath Path to the plugin file
      * @return std::string Compact JSON object, or empty string if extraction failed
      */
-    static std::string getRawMetadataJson(const std::string& pluginPath);
+    static std::string getRawMetadataJson(std::string_view pluginPath);
 
     /**
      * @brief Get the dependency list from a plugin file without loading it.
@@ -162,15 +439,30 @@ public:
      * @param pluginPath Path to the plugin file
      * @return std::vector<std::string> The list of dependency names, or empty list if extraction failed
      */
-    static std::vector<std::string> getModuleDependencies(const std::string& pluginPath);
+    static std::vector<std::string> getModuleDependencies(std::string_view pluginPath);
     
     /**
      * @brief Check if the handle contains a valid loaded plugin
+     * 
+     * A lazy handle (see lazyFromPath()) counts as valid until its deferred
+     * load fails; this check never triggers the load.
      */
     bool isValid() const;
+
+    /**
+     * @brief Check if the plugin instance exists, without triggering a deferred load
+     */
+    bool isLoaded() const;
+    
+    /**
+     * @brief Check if this handle comes from loadShared()
+     */
+    bool isShared() const;
     
     /**
      * @brief Get the raw QObject instance of the plugin
+     * 
+     * Loads a lazy handle's plugin on first call.
      */
     QObject* instance() const;
     
@@ -183,6 +475,33 @@ public:
      * @brief Get the last error message if loading failed
      */
     QString errorString() const;
+
+    /**
+     * @brief What the plugin printed while loading with LoadOptions::Capture.
+     */
+    const QByteArray& capturedOutput() const;
+
+    /**
+     * @brief Durations and sizes of this handle's load and introspection phases.
+     *
+     * Kept across unload(); not thread-safe, like the introspection calls
+     * that fill it in.
+     */
+    const LoadStats& loadStats() const;
+
+    /**
+     * @brief Memory attributed to this plugin (see MemoryStats).
+     */
+    MemoryStats memoryStats() const;
+
+    /**
+     * @brief Enable or disable measuring MemoryStats in loadFromPath().
+     *
+     * Off by default: it lists the process's shared objects and reads its
+     * resident size before and after every load.
+     */
+    static void setMemoryTracking(bool enabled);
+    static bool isMemoryTracking();
     
     /**
      * @brief Cast the plugin instance to a specific interface type.
@@ -194,22 +513,55 @@ public:
      */
     template<typename T>
     T* as() const {
-        if (!m_instance) {
+        QObject* object = instance();
+        if (!object) {
             return nullptr;
         }
-        return qobject_cast<T*>(m_instance);
+        return qobject_cast<T*>(object);
     }
     
     /**
      * @brief Unload the plugin and release resources
+     * 
+     * A shared handle (see loadShared()) only drops its reference; the
+     * plugin is unloaded with the last one.
      */
     void unload();
     
+    /**
+     * @brief Unload the plugin and load it again from the same file.
+     * 
+     * Meant for plugins rebuilt in place (see ModuleWatcher): the old loader
+     * is unloaded first, so the new file is mapped instead of the library
+     * already in memory, then the plugin is loaded as loadFromPath() does,
+     * or deferred again for a lazy handle that was never loaded. Metadata,
+     * interface and load statistics are those of the new file. The old
+     * instance must not be referenced any more. This only maps the new file
+     * if no other loader still holds the library. Handles without a file
+     * (static or wrapped plugins) cannot be reloaded.
+     * 
+     * @param errorString Optional pointer to receive an error message on failure
+     * @return bool True if the plugin was reloaded; otherwise the handle is
+     *         left invalid with errorString() set
+     */
+    bool reload(QString* errorString = nullptr);
+
+    /**
+     * @brief Unload the plugin and load it again (std::string overload).
+     */
+    bool reload(std::string* errorString);
+
+    /**
+     * @brief Path of the plugin file, or an empty string for static and wrapped plugins.
+     */
+    QString pluginPath() const;
+    
     /**
      * @brief Release ownership of the plugin instance without unloading.
      * 
      * After calling this, the LogosModule no longer manages the plugin lifecycle.
-     * The caller is responsible for ensuring proper cleanup.
+     * The caller is responsible for ensuring proper cleanup. For a shared
+     * handle, the plugin is then never unloaded by the registry.
      * 
      * @return QObject* The plugin instance (ownership transferred to caller)
      */
@@ -218,6 +570,13 @@ public:
     /**
      * @brief Get all methods defined by this plugin.
      * 
+     * The instance introspection methods (getMethods, getMethodsAsJson,
+     * getEventsAsJson, hasMethod) share one lazily built interface: a
+     * provider plugin's provider object is created once per handle and its
+     * interface fetched and split into methods and events once, together
+     * with a name/signature index for hasMethod() and findMethod(). The
+     * cache is dropped by unload() and release(). Not thread-safe.
+     * 
      * @param excludeBaseClass If true, excludes methods inherited from QObject
      * @return std::vector<MethodInfo> List of methods defined by the plugin
      */
@@ -242,6 +601,58 @@ public:
      */
     QJsonArray getEventsAsJson() const;
 
+    /**
+     * @brief Write the methods array into a JsonWriter.
+     *
+     * Same content as getMethodsAsJson(), streamed without building QJson
+     * objects; a provider's interface array is written as-is.
+     *
+     * @param writer The writer, positioned where a value is expected
+     * @param excludeBaseClass If true, excludes methods inherited from QObject
+     */
+    void writeMethodsJson(JsonWriter& writer, bool excludeBaseClass = true) const;
+
+    /**
+     * @brief Write the events array into a JsonWriter.
+     *
+     * @param writer The writer, positioned where a value is expected
+     */
+    void writeEventsJson(JsonWriter& writer) const;
+
+    /**
+     * @brief The methods array as a JSON document.
+     *
+     * Serialized once per interface and format, then served from memory;
+     * byte-identical to QJsonDocument(getMethodsAsJson()).toJson() in the
+     * same format. The reference is valid as long as interfaceTable()'s.
+     *
+     * @param format Indented (as QJsonDocument::Indented) or Compact
+     * @param excludeBaseClass If true, excludes methods inherited from QObject
+     * @return const std::string& The JSON text
+     */
+    const std::string& methodsJsonText(JsonFormat format = JsonFormat::Indented,
+                                       bool excludeBaseClass = true) const;
+
+    /**
+     * @brief The events array as a JSON document (see methodsJsonText()).
+     *
+     * @param format Indented (as QJsonDocument::Indented) or Compact
+     * @return const std::string& The JSON text
+     */
+    const std::string& eventsJsonText(JsonFormat format = JsonFormat::Indented) const;
+
+    /**
+     * @brief Get the plugin's compact interface table.
+     *
+     * The flat, string-interned form behind getMethods() and findMethod();
+     * it lists inherited QObject methods first for legacy plugins (see
+     * InterfaceTable::ownMethodOffset()). The reference is valid until the
+     * handle is unloaded, released, reassigned or destroyed.
+     *
+     * @return const InterfaceTable& The interface table (empty if not loaded)
+     */
+    const InterfaceTable& interfaceTable() const;
+
     /**
      * @brief Get the class name of the plugin's meta-object.
      * 
@@ -264,6 +675,28 @@ public:
      * @return bool True if the method exists
      */
     bool hasMethod(const std::string& methodName) const;
+
+    /**
+     * @brief Look up a method by name or by full signature.
+     * 
+     * Answered from a hash index built once with the cached interface. A bare
+     * name matches the first declared overload; a signature such as
+     * "foo(QString,int)" selects one exactly (normalized as by
+     * QMetaObject::normalizedSignature). For legacy plugins the result's
+     * metaMethodIndex can be passed to metaObject()->method() for dispatch.
+     * 
+     * @param nameOrSignature A method name or signature
+     * @return std::optional<MethodInfo> The method, or std::nullopt if not found
+     */
+    std::optional<MethodInfo> findMethod(const QString& nameOrSignature) const;
+
+    /**
+     * @brief Look up a method by name or by full signature (std::string overload).
+     * 
+     * @param nameOrSignature A method name or signature
+     * @return std::optional<MethodInfo> The method, or std::nullopt if not found
+     */
+    std::optional<MethodInfo> findMethod(const std::string& nameOrSignature) const;
     
     /**
      * @brief Get all methods defined by an arbitrary QObject.
@@ -308,12 +741,61 @@ public:
      */
     static bool hasMethod(QObject* obj, const QString& methodName);
 
+    /**
+     * @brief Drop the shared per-class introspection cache.
+     * 
+     * Legacy (QMetaObject-based) interface descriptions are built once per
+     * class and shared by every handle and static introspection call, keyed
+     * by the class's QMetaObject. unload() drops the entry of the plugin it
+     * unloads; call this after unloading plugins by other means (e.g. a
+     * released instance's QPluginLoader) so no entry outlives its library.
+     */
+    static void clearIntrospectionCache();
+
 private:
-    QPluginLoader* m_loader = nullptr;
-    QObject* m_instance = nullptr;
+    // Move the instance and its loader to another thread (called from the
+    // thread they currently live in)
+    void moveToThread(QThread* thread);
+
+    // Memoized interface of m_instance: the provider object (new API) and
+    // the method/event description derived from it, or the shared
+    // description of the plugin's QMetaObject. Built on the first
+    // introspection call (once, under LazyLoad::interfaceOnce, for a lazy
+    // handle), dropped by unload()/release().
+    struct InterfaceCache;
+    const InterfaceCache& interfaceCache() const;
+    std::unique_ptr<InterfaceCache> buildInterfaceCache() const;
+    void resetInterfaceCache();
+
+    // Deferred load of a lazyFromPath() handle: set until the handle is
+    // unloaded or released. ensureLoaded() runs the load at most once;
+    // m_loader, m_instance and m_errorString are only written by it then.
+    struct LazyLoad;
+    void ensureLoaded() const;
+
+    // Verified sidecar of a lazy handle that is not loaded yet, or nullptr
+    const InterfaceSidecar* pendingSidecar() const;
+
+    // Out-of-process interface of an isolatedFromPath() handle that is not
+    // loaded yet, or nullptr (also once the helper failed)
+    const IsolatedInterface* pendingIsolatedInterface() const;
+
+    mutable QPluginLoader* m_loader = nullptr;
+    mutable QObject* m_instance = nullptr;
     ModuleMetadata m_metadata;
-    QString m_errorString;
+    mutable QString m_errorString;
     bool m_isStatic = false;
+    mutable std::unique_ptr<InterfaceCache> m_interface;
+    std::unique_ptr<LazyLoad> m_lazy;
+    mutable LoadStats m_stats;
+    mutable MemoryStats m_memory;
+    QByteArray m_capturedOutput;
+
+    // Registry entry of a loadShared() handle: owns the loader that
+    // m_loader / m_instance point into, unloaded with its last handle.
+    struct SharedLoad;
+    static LogosModule fromShared(const std::shared_ptr<SharedLoad>& shared);
+    std::shared_ptr<SharedLoad> m_shared;
 };
 
 } // namespace ModuleLib
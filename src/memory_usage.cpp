@@ -0,0 +1,114 @@
+#include "memory_usage.h"
+
+#if defined(__linux__)
+#include <link.h>
+#include <unistd.h>
+#include <cstdio>
+#elif defined(__APPLE__)
+#include <mach-o/dyld.h>
+#include <mach-o/loader.h>
+#include <mach/mach.h>
+#include <cstring>
+#endif
+
+namespace ModuleLib {
+namespace MemoryUsage {
+
+#if defined(__linux__)
+
+std::int64_t residentBytes() {
+    // statm: size resident shared text lib data dt, in pages
+    std::FILE* file = std::fopen("/proc/self/statm", "r");
+    if (!file) {
+        return -1;
+    }
+    long long size = 0;
+    long long resident = 0;
+    const int fields = std::fscanf(file, "%lld %lld", &size, &resident);
+    std::fclose(file);
+    if (fields != 2) {
+        return -1;
+    }
+    return static_cast<std::int64_t>(resident) * ::sysconf(_SC_PAGESIZE);
+}
+
+std::vector<SharedObjectInfo> sharedObjects() {
+    std::vector<SharedObjectInfo> objects;
+    ::dl_iterate_phdr([](struct dl_phdr_info* info, size_t, void* data) {
+        // The main program (and the vDSO on some systems) has no name
+        if (!info->dlpi_name || !*info->dlpi_name) {
+            return 0;
+        }
+        const std::uint64_t page = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+        SharedObjectInfo object;
+        object.path = info->dlpi_name;
+        for (ElfW(Half) i = 0; i < info->dlpi_phnum; ++i) {
+            const ElfW(Phdr)& header = info->dlpi_phdr[i];
+            if (header.p_type == PT_LOAD) {
+                // Segments start mid-page at p_vaddr % page
+                const std::uint64_t start = header.p_vaddr & ~(page - 1);
+                const std::uint64_t end = (header.p_vaddr + header.p_memsz + page - 1) & ~(page - 1);
+                object.mappedBytes += end - start;
+            }
+        }
+        static_cast<std::vector<SharedObjectInfo>*>(data)->push_back(std::move(object));
+        return 0;
+    }, &objects);
+    return objects;
+}
+
+#elif defined(__APPLE__)
+
+std::int64_t residentBytes() {
+    mach_task_basic_info_data_t info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+        return -1;
+    }
+    return static_cast<std::int64_t>(info.resident_size);
+}
+
+std::vector<SharedObjectInfo> sharedObjects() {
+    std::vector<SharedObjectInfo> objects;
+    const uint32_t count = _dyld_image_count();
+    // Image 0 is the main executable
+    for (uint32_t i = 1; i < count; ++i) {
+        const auto* header = reinterpret_cast<const mach_header_64*>(_dyld_get_image_header(i));
+        const char* name = _dyld_get_image_name(i);
+        if (!header || !name || header->magic != MH_MAGIC_64) {
+            continue;
+        }
+        SharedObjectInfo object;
+        object.path = name;
+        const auto* command = reinterpret_cast<const load_command*>(header + 1);
+        for (uint32_t c = 0; c < header->ncmds; ++c) {
+            if (command->cmd == LC_SEGMENT_64) {
+                const auto* segment = reinterpret_cast<const segment_command_64*>(command);
+                // __PAGEZERO reserves address space only
+                if (std::strcmp(segment->segname, SEG_PAGEZERO) != 0) {
+                    object.mappedBytes += segment->vmsize;
+                }
+            }
+            command = reinterpret_cast<const load_command*>(
+                reinterpret_cast<const char*>(command) + command->cmdsize);
+        }
+        objects.push_back(std::move(object));
+    }
+    return objects;
+}
+
+#else
+
+std::int64_t residentBytes() {
+    return -1;
+}
+
+std::vector<SharedObjectInfo> sharedObjects() {
+    return {};
+}
+
+#endif
+
+} // namespace MemoryUsage
+} // namespace ModuleLib
@@ -0,0 +1,45 @@
+#ifndef MEMORY_USAGE_H
+#define MEMORY_USAGE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ModuleLib {
+
+/**
+ * @brief A shared object mapped into the process.
+ */
+struct SharedObjectInfo {
+    std::string path;
+
+    // Size of its loadable segments (PT_LOAD / Mach-O segments), page-rounded
+    std::uint64_t mappedBytes = 0;
+};
+
+/**
+ * @brief Utilities for measuring the process's memory, used to attribute
+ *        resident cost to loaded modules (see LogosModule::memoryStats()).
+ *
+ * Supported on Linux (/proc/self/statm, dl_iterate_phdr) and macOS
+ * (task_info, dyld). Elsewhere residentBytes() is -1 and sharedObjects()
+ * is empty.
+ */
+namespace MemoryUsage {
+
+/**
+ * @brief The process's current resident set size in bytes, or -1 if unknown.
+ */
+std::int64_t residentBytes();
+
+/**
+ * @brief The shared objects currently mapped into the process, in load order.
+ *
+ * The main executable is not included.
+ */
+std::vector<SharedObjectInfo> sharedObjects();
+
+} // namespace MemoryUsage
+} // namespace ModuleLib
+
+#endif // MEMORY_USAGE_H
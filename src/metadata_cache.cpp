@@ -0,0 +1,114 @@
+#include "metadata_cache.h"
+#include "metadata_index.h"
+#include <QFileInfo>
+
+namespace ModuleLib {
+
+namespace {
+std::string cacheKey(const QString& pluginPath) {
+    return QFileInfo(pluginPath).absoluteFilePath().toStdString();
+}
+} // namespace
+
+MetadataCache& MetadataCache::global() {
+    static MetadataCache cache;
+    return cache;
+}
+
+void MetadataCache::setEnabled(bool enabled) {
+    m_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool MetadataCache::isEnabled() const {
+    return m_enabled.load(std::memory_order_relaxed);
+}
+
+std::optional<ModuleMetadata> MetadataCache::get(const QString& pluginPath) {
+    if (pluginPath.isEmpty()) {
+        return std::nullopt;
+    }
+
+    const std::string key = cacheKey(pluginPath);
+    const std::optional<FileIdentity> identity = FileIdentity::of(key);
+    if (!identity) {
+        // Gone (or never existed): make sure a stale entry cannot be served.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.erase(key);
+        return std::nullopt;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end() && it->second.identity == *identity && it->second.hasMetadata) {
+            return it->second.metadata;
+        }
+    }
+
+    // Read outside the lock so concurrent misses on different files do not
+    // serialize behind one another.
+    std::optional<ModuleMetadata> metadata = MetadataIndex::findOrRead(pluginPath);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries[key];
+    if (entry.identity != *identity) {
+        entry = Entry();
+        entry.identity = *identity;
+    }
+    entry.hasMetadata = true;
+    entry.metadata = metadata;
+    return metadata;
+}
+
+std::optional<ModuleMetadata> MetadataCache::get(const std::string& pluginPath) {
+    return get(QString::fromStdString(pluginPath));
+}
+
+std::optional<QByteArray> MetadataCache::interfaceData(const QString& pluginPath) {
+    const std::string key = cacheKey(pluginPath);
+    const std::optional<FileIdentity> identity = FileIdentity::of(key);
+    if (!identity) {
+        return std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end() || it->second.identity != *identity) {
+        return std::nullopt;
+    }
+    return it->second.interfaceData;
+}
+
+void MetadataCache::storeInterfaceData(const QString& pluginPath, const FileIdentity& identity,
+                                       QByteArray data) {
+    const std::string key = cacheKey(pluginPath);
+    if (FileIdentity::of(key) != identity) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Entry& entry = m_entries[key];
+    if (entry.identity != identity) {
+        entry = Entry();
+        entry.identity = identity;
+    }
+    entry.interfaceData = std::move(data);
+}
+
+void MetadataCache::invalidate(const QString& pluginPath) {
+    const std::string key = cacheKey(pluginPath);
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.erase(key);
+}
+
+void MetadataCache::clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_entries.clear();
+}
+
+std::size_t MetadataCache::size() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_entries.size();
+}
+
+} // namespace ModuleLib
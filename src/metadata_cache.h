@@ -0,0 +1,124 @@
+#ifndef METADATA_CACHE_H
+#define METADATA_CACHE_H
+
+#include "file_identity.h"
+#include "module_metadata.h"
+#include <QByteArray>
+#include <QString>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace ModuleLib {
+
+/**
+ * @brief MetadataCache memoizes metadata reads per plugin file.
+ *
+ * Entries are keyed by absolute path and stamped with the file's
+ * FileIdentity (mtime, size, inode). A lookup only stat()s the file and
+ * returns the cached result while the identity is unchanged; a rewritten or
+ * replaced file is read again (from the directory's MetadataIndex when it has
+ * a fresh entry, otherwise from the binary). Failed reads are cached too, so repeated scans
+ * over a directory containing non-plugin files stay cheap. Entries can also
+ * hold a plugin's encoded interface, taken out of process by
+ * IsolatedIntrospection, under the same identity.
+ *
+ * The process-wide instance returned by global() is opt-in: once enabled,
+ * LogosModule::extractMetadata() (and the helpers built on it) are served
+ * from it. Separate instances can also be created and used directly.
+ *
+ * All methods are thread-safe.
+ *
+ * Example usage:
+ * @code
+ * MetadataCache::global().setEnabled(true);
+ * auto metadata = LogosModule::extractMetadata(path);  // read + cached
+ * metadata = LogosModule::extractMetadata(path);       // stat only
+ * @endcode
+ */
+class MetadataCache {
+public:
+    MetadataCache() = default;
+    MetadataCache(const MetadataCache&) = delete;
+    MetadataCache& operator=(const MetadataCache&) = delete;
+
+    /**
+     * @brief The process-wide cache consulted by LogosModule::extractMetadata().
+     */
+    static MetadataCache& global();
+
+    /**
+     * @brief Enable or disable serving extractMetadata() from this cache.
+     *
+     * Only meaningful for global(); disabling does not drop existing entries.
+     */
+    void setEnabled(bool enabled);
+    bool isEnabled() const;
+
+    /**
+     * @brief Return the metadata for a plugin file, reading it only if the
+     *        file changed since the last read.
+     *
+     * @param pluginPath Path to the plugin file
+     * @return std::optional<ModuleMetadata> The metadata if extraction succeeded
+     */
+    std::optional<ModuleMetadata> get(const QString& pluginPath);
+
+    /**
+     * @brief Return the metadata for a plugin file (std::string overload).
+     */
+    std::optional<ModuleMetadata> get(const std::string& pluginPath);
+
+    /**
+     * @brief Encoded interface stored for a plugin file by storeInterfaceData().
+     *
+     * @param pluginPath Path to the plugin file
+     * @return std::optional<QByteArray> The stored bytes, or std::nullopt if none were
+     *         stored for the file as it is now
+     */
+    std::optional<QByteArray> interfaceData(const QString& pluginPath);
+
+    /**
+     * @brief Store an encoded interface (see IsolatedIntrospection) for a plugin file.
+     *
+     * @param pluginPath Path to the plugin file
+     * @param identity   Identity of the file the interface was taken from;
+     *                   nothing is stored if the file has changed since
+     * @param data       The encoded interface
+     */
+    void storeInterfaceData(const QString& pluginPath, const FileIdentity& identity, QByteArray data);
+
+    /**
+     * @brief Drop the entry for a plugin file, forcing the next get() to re-read it.
+     */
+    void invalidate(const QString& pluginPath);
+
+    /**
+     * @brief Drop all entries.
+     */
+    void clear();
+
+    /**
+     * @brief Number of cached entries.
+     */
+    std::size_t size() const;
+
+private:
+    struct Entry {
+        FileIdentity identity;
+        bool hasMetadata = false;
+        std::optional<ModuleMetadata> metadata;
+        std::optional<QByteArray> interfaceData;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_entries;
+    std::atomic<bool> m_enabled{false};
+};
+
+} // namespace ModuleLib
+
+#endif // METADATA_CACHE_H
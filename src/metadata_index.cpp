@@ -0,0 +1,232 @@
+#include "metadata_index.h"
+#include "file_identity.h"
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonParseError>
+#include <QLibrary>
+#include <QSaveFile>
+#include <QDebug>
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace ModuleLib {
+
+namespace {
+QJsonObject identityToJson(const FileIdentity& identity) {
+    QJsonObject obj;
+    obj["mtime_ns"] = QString::number(identity.mtimeNs);
+    obj["size"] = QString::number(identity.size);
+    obj["inode"] = QString::number(identity.inode);
+    obj["device"] = QString::number(identity.device);
+    return obj;
+}
+
+bool identityMatches(const QJsonObject& entry, const FileIdentity& identity) {
+    return entry.value("mtime_ns").toString() == QString::number(identity.mtimeNs)
+        && entry.value("size").toString() == QString::number(identity.size)
+        && entry.value("inode").toString() == QString::number(identity.inode)
+        && entry.value("device").toString() == QString::number(identity.device);
+}
+
+// Loaded indexes, keyed by absolute directory and stamped with the identity
+// of the index file they were parsed from.
+struct LoadedIndex {
+    FileIdentity identity;
+    std::shared_ptr<const MetadataIndex> index;
+};
+
+std::mutex s_loadedMutex;
+std::map<QString, LoadedIndex> s_loaded;
+} // namespace
+
+QString MetadataIndex::indexPath(const QString& directory) {
+    return QDir(directory).filePath(QString::fromLatin1(FileName));
+}
+
+std::optional<MetadataIndex> MetadataIndex::load(const QString& directory) {
+    QFile file(indexPath(directory));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return std::nullopt;
+    }
+
+    const qint64 size = file.size();
+    if (size <= 0) {
+        return std::nullopt;
+    }
+
+    // Parse straight out of the page cache; QJsonDocument copies what it keeps.
+    QJsonParseError parseError;
+    QJsonDocument doc;
+    if (uchar* mapped = file.map(0, size)) {
+        doc = QJsonDocument::fromJson(
+            QByteArray::fromRawData(reinterpret_cast<const char*>(mapped), static_cast<int>(size)),
+            &parseError);
+        file.unmap(mapped);
+    } else {
+        doc = QJsonDocument::fromJson(file.readAll(), &parseError);
+    }
+
+    if (parseError.error != QJsonParseError::NoError || !doc.isObject()) {
+        qWarning() << "MetadataIndex: Ignoring unreadable index:" << file.fileName()
+                   << parseError.errorString();
+        return std::nullopt;
+    }
+
+    const QJsonObject root = doc.object();
+    if (root.value("version").toInt() != FormatVersion) {
+        return std::nullopt;
+    }
+
+    MetadataIndex index;
+    index.m_directory = QFileInfo(directory).absoluteFilePath();
+    index.m_modules = root.value("modules").toObject();
+    return index;
+}
+
+bool MetadataIndex::build(const QString& directory, QString* errorString, int* moduleCount) {
+    QDir dir(directory);
+    if (!dir.exists()) {
+        if (errorString) {
+            *errorString = QStringLiteral("Directory not found: ") + directory;
+        }
+        return false;
+    }
+
+    const std::optional<MetadataIndex> previous = load(directory);
+
+    QJsonObject modules;
+    const QFileInfoList entries = dir.entryInfoList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+    for (const QFileInfo& entry : entries) {
+        if (!QLibrary::isLibrary(entry.fileName())) {
+            continue;
+        }
+
+        const auto identity = FileIdentity::of(entry.absoluteFilePath().toStdString());
+        if (!identity) {
+            continue;
+        }
+
+        QJsonObject record;
+        if (previous) {
+            const QJsonObject old = previous->m_modules.value(entry.fileName()).toObject();
+            if (!old.isEmpty() && identityMatches(old, *identity)) {
+                record = old;
+            }
+        }
+
+        if (record.isEmpty()) {
+            const auto metadata = ModuleMetadata::fromPath(entry.absoluteFilePath());
+            if (!metadata) {
+                continue;
+            }
+            record = identityToJson(*identity);
+            record["metadata"] = QString::fromStdString(metadata->rawMetadataJson);
+        }
+
+        modules[entry.fileName()] = record;
+    }
+
+    QJsonObject root;
+    root["version"] = FormatVersion;
+    root["modules"] = modules;
+
+    QSaveFile out(indexPath(directory));
+    if (!out.open(QIODevice::WriteOnly)) {
+        if (errorString) {
+            *errorString = out.errorString();
+        }
+        return false;
+    }
+    out.write(QJsonDocument(root).toJson(QJsonDocument::Compact));
+    if (!out.commit()) {
+        if (errorString) {
+            *errorString = out.errorString();
+        }
+        return false;
+    }
+
+    if (moduleCount) {
+        *moduleCount = modules.size();
+    }
+    return true;
+}
+
+std::optional<ModuleMetadata> MetadataIndex::lookup(const QString& pluginPath) {
+    if (pluginPath.isEmpty()) {
+        return std::nullopt;
+    }
+
+    const QFileInfo pluginInfo(pluginPath);
+    const QString directory = pluginInfo.absolutePath();
+
+    // No index file is the common case; it costs one stat().
+    const auto identity = FileIdentity::of(indexPath(directory).toStdString());
+    if (!identity) {
+        return std::nullopt;
+    }
+
+    std::shared_ptr<const MetadataIndex> index;
+    bool cached = false;
+    {
+        std::lock_guard<std::mutex> lock(s_loadedMutex);
+        auto it = s_loaded.find(directory);
+        if (it != s_loaded.end() && it->second.identity == *identity) {
+            index = it->second.index;
+            cached = true;
+        }
+    }
+
+    if (!cached) {
+        std::optional<MetadataIndex> loaded = load(directory);
+        if (loaded) {
+            index = std::make_shared<const MetadataIndex>(std::move(*loaded));
+        }
+        std::lock_guard<std::mutex> lock(s_loadedMutex);
+        s_loaded[directory] = LoadedIndex{*identity, index};
+    }
+
+    if (!index) {
+        return std::nullopt;
+    }
+    return index->find(pluginInfo.fileName());
+}
+
+std::optional<ModuleMetadata> MetadataIndex::findOrRead(const QString& pluginPath) {
+    if (auto metadata = lookup(pluginPath)) {
+        return metadata;
+    }
+    return ModuleMetadata::fromPath(pluginPath);
+}
+
+std::optional<ModuleMetadata> MetadataIndex::find(const QString& fileName) const {
+    const QJsonObject entry = m_modules.value(fileName).toObject();
+    if (entry.isEmpty()) {
+        return std::nullopt;
+    }
+
+    const auto identity = FileIdentity::of(QDir(m_directory).filePath(fileName).toStdString());
+    if (!identity || !identityMatches(entry, *identity)) {
+        return std::nullopt;
+    }
+
+    // Stored as its compact text, which becomes rawMetadataJson as is
+    const QByteArray text = entry.value("metadata").toString().toUtf8();
+    const QJsonDocument doc = QJsonDocument::fromJson(text);
+    if (!doc.isObject()) {
+        return std::nullopt;
+    }
+    ModuleMetadata metadata = ModuleMetadata::fromCustomMetadata(doc.object(), text.toStdString());
+    if (!metadata.isValid()) {
+        return std::nullopt;
+    }
+    return metadata;
+}
+
+QStringList MetadataIndex::fileNames() const {
+    return m_modules.keys();
+}
+
+} // namespace ModuleLib
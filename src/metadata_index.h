@@ -0,0 +1,120 @@
+#ifndef METADATA_INDEX_H
+#define METADATA_INDEX_H
+
+#include "module_metadata.h"
+#include <QJsonObject>
+#include <QString>
+#include <QStringList>
+#include <optional>
+
+namespace ModuleLib {
+
+/**
+ * @brief MetadataIndex is a persisted snapshot of the metadata of every
+ *        plugin in one module directory.
+ *
+ * The index lives next to the plugins it describes, in
+ * `{directory}/.logos-module-index.json`, and records each plugin's
+ * FileIdentity together with its raw "MetaData" object, stored as the
+ * compact JSON text of ModuleMetadata::rawMetadataJson:
+ *
+ * @code
+ * {
+ *   "version": 2,
+ *   "modules": {
+ *     "foo_plugin.so": {
+ *       "mtime_ns": "1760000000000000000", "size": "123456",
+ *       "inode": "42", "device": "2049",
+ *       "metadata": "{\"name\":\"foo\",...}"
+ *     }
+ *   }
+ * }
+ * @endcode
+ *
+ * Identity fields are decimal strings so 64-bit values survive JSON's
+ * double-precision numbers. Keeping the metadata as text lets a hit hand
+ * it out as rawMetadataJson without serializing it again. An entry is only trusted while the plugin's
+ * current identity still matches; otherwise the plugin binary is read as
+ * usual. The index is memory-mapped and read-only at runtime; it is written
+ * by build() (`lm index <dir>`).
+ */
+class MetadataIndex {
+public:
+    /// Name of the index file inside a module directory.
+    static constexpr const char* FileName = ".logos-module-index.json";
+
+    /// Current on-disk format version; indexes with any other version are ignored.
+    static constexpr int FormatVersion = 2;
+
+    /**
+     * @brief Path of the index file for a module directory.
+     */
+    static QString indexPath(const QString& directory);
+
+    /**
+     * @brief Load the index of a module directory.
+     *
+     * @param directory The module directory
+     * @return std::optional<MetadataIndex> The index, or std::nullopt if there is
+     *         no index or it cannot be parsed
+     */
+    static std::optional<MetadataIndex> load(const QString& directory);
+
+    /**
+     * @brief Build (or refresh) the index of a module directory.
+     *
+     * Every plugin file in the directory is recorded. Entries of an existing
+     * index whose identity still matches are reused without re-reading the
+     * plugin. The index is replaced atomically.
+     *
+     * @param directory    The module directory
+     * @param errorString  Optional pointer to receive an error message on failure
+     * @param moduleCount  Optional pointer to receive the number of indexed plugins
+     * @return bool True if the index was written
+     */
+    static bool build(const QString& directory, QString* errorString = nullptr,
+                      int* moduleCount = nullptr);
+
+    /**
+     * @brief Metadata for a plugin from the index of the plugin's own directory.
+     *
+     * Loaded indexes are kept in a process-wide, thread-safe cache and reloaded
+     * when the index file changes.
+     *
+     * @param pluginPath Path to the plugin file
+     * @return std::optional<ModuleMetadata> The metadata, or std::nullopt if the
+     *         directory has no index or the entry is missing or stale
+     */
+    static std::optional<ModuleMetadata> lookup(const QString& pluginPath);
+
+    /**
+     * @brief Metadata for a plugin: from its directory's index if fresh,
+     *        otherwise read from the binary via ModuleMetadata::fromPath().
+     */
+    static std::optional<ModuleMetadata> findOrRead(const QString& pluginPath);
+
+    /**
+     * @brief Metadata for a plugin in this index, if its entry is fresh.
+     *
+     * @param fileName File name of the plugin within the indexed directory
+     */
+    std::optional<ModuleMetadata> find(const QString& fileName) const;
+
+    /**
+     * @brief File names of all plugins recorded in this index.
+     */
+    QStringList fileNames() const;
+
+    /**
+     * @brief The indexed directory.
+     */
+    QString directory() const { return m_directory; }
+
+private:
+    QString m_directory;
+    QJsonObject m_modules;
+};
+
+} // namespace ModuleLib
+
+#endif // METADATA_INDEX_H
@@ -0,0 +1,251 @@
+#include "module_graph.h"
+#include "logos_module.h"
+#include <QDebug>
+#include <QHash>
+#include <QThread>
+#include <algorithm>
+#include <functional>
+#include <future>
+
+namespace ModuleLib {
+
+LoadedModules& LoadedModules::operator=(LoadedModules&& other) noexcept {
+    if (this != &other) {
+        clear();
+        m_modules = std::move(other.m_modules);
+    }
+    return *this;
+}
+
+void LoadedModules::clear() {
+    while (!m_modules.empty()) {
+        m_modules.pop_back();
+    }
+}
+
+ModuleGraph ModuleGraph::fromPaths(const std::vector<std::string>& pluginPaths,
+                                   unsigned maxThreads) {
+    return fromMetadata(ModuleMetadata::fromPaths(pluginPaths, maxThreads));
+}
+
+ModuleGraph ModuleGraph::fromMetadata(std::vector<MetadataResult> results) {
+    ModuleGraph graph;
+    QHash<QString, std::size_t> byName;
+
+    for (MetadataResult& result : results) {
+        if (!result.ok()) {
+            graph.m_errors.push_back(result.path + ": " +
+                                     (result.error.empty() ? "no module metadata" : result.error));
+            continue;
+        }
+        const QString& name = result.metadata->name;
+        auto existing = byName.constFind(name);
+        if (existing != byName.constEnd()) {
+            graph.m_errors.push_back(result.path + ": duplicate module name '" +
+                                     name.toStdString() + "' (also " +
+                                     graph.m_modules[*existing].path + ")");
+            continue;
+        }
+        byName.insert(name, graph.m_modules.size());
+        graph.m_modules.push_back({std::move(result.path), std::move(*result.metadata), {}});
+    }
+
+    graph.m_missingDependency.assign(graph.m_modules.size(), false);
+    for (std::size_t i = 0; i < graph.m_modules.size(); ++i) {
+        Node& node = graph.m_modules[i];
+        for (const QString& dependency : node.metadata.dependencies) {
+            auto it = byName.constFind(dependency);
+            if (it == byName.constEnd()) {
+                graph.m_errors.push_back(node.metadata.name.toStdString() +
+                                         ": missing dependency '" +
+                                         dependency.toStdString() + "'");
+                graph.m_missingDependency[i] = true;
+                continue;
+            }
+            node.dependencies.push_back(*it);
+        }
+    }
+
+    graph.computeWaves();
+    return graph;
+}
+
+ModuleGraph ModuleGraph::fromPaths(const QStringList& pluginPaths, unsigned maxThreads) {
+    std::vector<std::string> paths;
+    paths.reserve(static_cast<std::size_t>(pluginPaths.size()));
+    for (const QString& path : pluginPaths) {
+        paths.push_back(path.toStdString());
+    }
+    return fromPaths(paths, maxThreads);
+}
+
+void ModuleGraph::computeWaves() {
+    const std::size_t count = m_modules.size();
+    std::vector<std::vector<std::size_t>> dependents(count);
+    std::vector<std::size_t> pending(count, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t dependency : m_modules[i].dependencies) {
+            dependents[dependency].push_back(i);
+            ++pending[i];
+        }
+        // A missing dependency is never satisfied
+        if (m_missingDependency[i]) {
+            ++pending[i];
+        }
+    }
+
+    std::vector<bool> placed(count, false);
+    std::vector<std::size_t> wave;
+    for (std::size_t i = 0; i < count; ++i) {
+        if (pending[i] == 0) {
+            wave.push_back(i);
+        }
+    }
+
+    while (!wave.empty()) {
+        std::vector<bool> ready(count, false);
+        for (std::size_t i : wave) {
+            placed[i] = true;
+            for (std::size_t dependent : dependents[i]) {
+                if (--pending[dependent] == 0) {
+                    ready[dependent] = true;
+                }
+            }
+        }
+        m_waves.push_back(std::move(wave));
+
+        // Collecting by index keeps each wave in input order
+        wave.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (ready[i]) {
+                wave.push_back(i);
+            }
+        }
+    }
+
+    findCycles(placed);
+}
+
+void ModuleGraph::findCycles(const std::vector<bool>& placed) {
+    // Depth-first search over the unplaced modules; each edge back into the
+    // current path closes a cycle. Modules only blocked by a missing
+    // dependency have no such edge and were already reported.
+    enum class State { Unvisited, OnPath, Done };
+    std::vector<State> state(m_modules.size(), State::Unvisited);
+    std::vector<std::size_t> path;
+
+    std::function<void(std::size_t)> visit = [&](std::size_t i) {
+        state[i] = State::OnPath;
+        path.push_back(i);
+        for (std::size_t dependency : m_modules[i].dependencies) {
+            if (placed[dependency]) {
+                continue;
+            }
+            if (state[dependency] == State::OnPath) {
+                std::vector<std::string> cycle;
+                std::string description;
+                auto start = std::find(path.begin(), path.end(), dependency);
+                for (auto it = start; it != path.end(); ++it) {
+                    cycle.push_back(m_modules[*it].metadata.name.toStdString());
+                    description += cycle.back() + " -> ";
+                }
+                description += cycle.front();
+                m_errors.push_back("dependency cycle: " + description);
+                m_cycles.push_back(std::move(cycle));
+            } else if (state[dependency] == State::Unvisited) {
+                visit(dependency);
+            }
+        }
+        path.pop_back();
+        state[i] = State::Done;
+    };
+
+    for (std::size_t i = 0; i < m_modules.size(); ++i) {
+        if (!placed[i] && state[i] == State::Unvisited) {
+            visit(i);
+        }
+    }
+}
+
+std::vector<std::string> ModuleGraph::unresolved() const {
+    std::vector<bool> placed(m_modules.size(), false);
+    for (const auto& wave : m_waves) {
+        for (std::size_t i : wave) {
+            placed[i] = true;
+        }
+    }
+
+    std::vector<std::string> names;
+    for (std::size_t i = 0; i < m_modules.size(); ++i) {
+        if (!placed[i]) {
+            names.push_back(m_modules[i].metadata.name.toStdString());
+        }
+    }
+    return names;
+}
+
+std::vector<std::string> ModuleGraph::loadOrder() const {
+    std::vector<std::string> paths;
+    paths.reserve(m_modules.size());
+    for (const auto& wave : m_waves) {
+        for (std::size_t i : wave) {
+            paths.push_back(m_modules[i].path);
+        }
+    }
+    return paths;
+}
+
+LoadedModules ModuleGraph::load(QString* errorString) const {
+    std::vector<LogosModule> loaded;
+    if (!isValid()) {
+        if (errorString) {
+            *errorString = QString::fromStdString(m_errors.front());
+        }
+        qWarning() << "ModuleGraph: Not loading an invalid graph:" << m_errors.front().c_str();
+        return {};
+    }
+
+    loaded.reserve(m_modules.size());
+    QThread* caller = QThread::currentThread();
+    for (const auto& wave : m_waves) {
+        std::vector<std::future<LogosModule>> pending;
+        pending.reserve(wave.size());
+        for (std::size_t i : wave) {
+            pending.push_back(LogosModule::loadAsync(m_modules[i].path, caller));
+        }
+
+        // Collect the whole wave even after a failure, so no load is left running
+        QString failure;
+        for (std::size_t w = 0; w < wave.size(); ++w) {
+            LogosModule module = pending[w].get();
+            if (!module.isValid()) {
+                if (failure.isEmpty()) {
+                    failure = QString::fromStdString(m_modules[wave[w]].path) + ": " +
+                              module.errorString();
+                }
+                continue;
+            }
+            loaded.push_back(std::move(module));
+        }
+
+        if (!failure.isEmpty()) {
+            if (errorString) {
+                *errorString = failure;
+            }
+            qWarning() << "ModuleGraph: Stopped loading:" << failure;
+            break;
+        }
+    }
+    return LoadedModules(std::move(loaded));
+}
+
+LoadedModules ModuleGraph::load(std::string* errorString) const {
+    QString qError;
+    LoadedModules loaded = load(errorString ? &qError : nullptr);
+    if (errorString) {
+        *errorString = qError.toStdString();
+    }
+    return loaded;
+}
+
+} // namespace ModuleLib
@@ -0,0 +1,190 @@
+#ifndef MODULE_GRAPH_H
+#define MODULE_GRAPH_H
+
+#include "logos_module.h"
+#include "module_metadata.h"
+#include <QString>
+#include <QStringList>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ModuleLib {
+
+/**
+ * @brief LoadedModules owns the handles returned by ModuleGraph::load().
+ *
+ * The modules are kept in dependency order and released in reverse order
+ * when the list is destroyed, assigned to or cleared, so no module is
+ * unloaded while a module that depends on it is still loaded. (A plain
+ * std::vector does not specify the order in which it destroys elements.)
+ */
+class LoadedModules {
+public:
+    LoadedModules() = default;
+    explicit LoadedModules(std::vector<LogosModule> modules) : m_modules(std::move(modules)) {}
+    ~LoadedModules() { clear(); }
+
+    LoadedModules(LoadedModules&& other) noexcept = default;
+    LoadedModules& operator=(LoadedModules&& other) noexcept;
+    LoadedModules(const LoadedModules&) = delete;
+    LoadedModules& operator=(const LoadedModules&) = delete;
+
+    bool empty() const { return m_modules.empty(); }
+    std::size_t size() const { return m_modules.size(); }
+    LogosModule& operator[](std::size_t i) { return m_modules[i]; }
+    const LogosModule& operator[](std::size_t i) const { return m_modules[i]; }
+
+    std::vector<LogosModule>::iterator begin() { return m_modules.begin(); }
+    std::vector<LogosModule>::iterator end() { return m_modules.end(); }
+    std::vector<LogosModule>::const_iterator begin() const { return m_modules.begin(); }
+    std::vector<LogosModule>::const_iterator end() const { return m_modules.end(); }
+
+    /**
+     * @brief Release every module, the last loaded first.
+     */
+    void clear();
+
+private:
+    std::vector<LogosModule> m_modules;
+};
+
+/**
+ * @brief ModuleGraph orders a set of plugins by their declared dependencies
+ *        and loads them in parallel, one dependency level at a time.
+ *
+ * The graph is built from metadata only (ModuleMetadata::fromPaths), so no
+ * plugin is loaded to compute it. Dependencies are matched by module name
+ * against the other plugins of the set. Modules are grouped into waves:
+ * wave 0 holds the modules without dependencies, wave N the modules whose
+ * dependencies are all in earlier waves. load() loads each wave
+ * concurrently with LogosModule::loadAsync() and waits for it before
+ * starting the next, so startup takes roughly the critical path of the
+ * graph instead of the sum of all load times.
+ *
+ * Problems found while building the graph are reported by errors():
+ * unreadable files, duplicate module names, dependencies not provided by
+ * any module of the set, and dependency cycles. Modules that cannot be
+ * ordered because of them are listed by unresolved() and are in no wave.
+ *
+ * Example usage:
+ * @code
+ * ModuleGraph graph = ModuleGraph::fromPaths(pluginPaths);
+ * if (!graph.isValid()) {
+ *     for (const std::string& error : graph.errors())
+ *         qWarning() << error.c_str();
+ *     return;
+ * }
+ * QString error;
+ * LoadedModules modules = graph.load(&error);
+ * @endcode
+ */
+class ModuleGraph {
+public:
+    /**
+     * @brief One plugin of the graph.
+     */
+    struct Node {
+        std::string path;
+        ModuleMetadata metadata;
+
+        // Indices into modules() of the modules this one depends on
+        std::vector<std::size_t> dependencies;
+    };
+
+    /**
+     * @brief Build the graph of a set of plugin files.
+     *
+     * @param pluginPaths Paths to the plugin files
+     * @param maxThreads  Upper bound on metadata reader threads (0 = one per hardware thread)
+     * @return ModuleGraph The graph; check isValid() / errors()
+     */
+    static ModuleGraph fromPaths(const std::vector<std::string>& pluginPaths,
+                                 unsigned maxThreads = 0);
+
+    /**
+     * @brief Build the graph of a set of plugin files (QStringList overload).
+     */
+    static ModuleGraph fromPaths(const QStringList& pluginPaths, unsigned maxThreads = 0);
+
+    /**
+     * @brief Build the graph from metadata that has already been read.
+     *
+     * Accepts the results of ModuleMetadata::fromPaths / fromDirectory as-is;
+     * failed results are reported as errors.
+     */
+    static ModuleGraph fromMetadata(std::vector<MetadataResult> results);
+
+    /**
+     * @brief Check if every module could be ordered (no errors).
+     */
+    bool isValid() const { return m_errors.empty(); }
+
+    /**
+     * @brief Human-readable descriptions of the problems found, in discovery order.
+     */
+    const std::vector<std::string>& errors() const { return m_errors; }
+
+    /**
+     * @brief The modules of the graph, in input order.
+     *
+     * Unreadable files and later duplicates of a module name are not included.
+     */
+    const std::vector<Node>& modules() const { return m_modules; }
+
+    /**
+     * @brief Load levels: indices into modules(), in input order within a wave.
+     */
+    const std::vector<std::vector<std::size_t>>& waves() const { return m_waves; }
+
+    /**
+     * @brief Dependency cycles, each as the module names along the cycle.
+     */
+    const std::vector<std::vector<std::string>>& cycles() const { return m_cycles; }
+
+    /**
+     * @brief Names of the modules that are in no wave (missing or cyclic dependencies).
+     */
+    std::vector<std::string> unresolved() const;
+
+    /**
+     * @brief Plugin paths in dependency order (the waves, concatenated).
+     */
+    std::vector<std::string> loadOrder() const;
+
+    /**
+     * @brief Load every module, wave by wave, on the loader thread pool.
+     *
+     * The instances are moved to the calling thread, which blocks until
+     * loading is done. Nothing is loaded if the graph is not valid. If a
+     * module fails to load, the waves after its own are not started and the
+     * modules loaded so far are returned. The returned list releases them
+     * in reverse order, so no module outlives its dependencies.
+     *
+     * @param errorString Optional pointer to receive an error message on failure
+     * @return LoadedModules The loaded modules, in dependency order
+     */
+    LoadedModules load(QString* errorString = nullptr) const;
+
+    /**
+     * @brief Load every module, wave by wave (std::string overload).
+     */
+    LoadedModules load(std::string* errorString) const;
+
+private:
+    void computeWaves();
+    void findCycles(const std::vector<bool>& placed);
+
+    std::vector<Node> m_modules;
+    std::vector<std::vector<std::size_t>> m_waves;
+    std::vector<std::vector<std::string>> m_cycles;
+    std::vector<std::string> m_errors;
+
+    // Modules declaring a dependency that no module of the set provides
+    std::vector<bool> m_missingDependency;
+};
+
+} // namespace ModuleLib
+
+#endif // MODULE_GRAPH_H
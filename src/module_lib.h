@@ -12,6 +12,12 @@
  * Main components:
  * - ModuleMetadata: Plugin metadata extraction and storage
  * - LogosModule: Plugin loading, lifecycle management, and runtime introspection
+ * - InterfaceTable: Compact, string-interned interface descriptions
+ * - JsonWriter: Streaming JSON output without intermediate QJson trees
+ * - MetadataCache: Opt-in, stat-keyed memoization of metadata reads
+ * - MetadataIndex: Persisted per-directory metadata index (`lm index`)
+ * - ModuleGraph: Dependency-ordered, parallel loading of a set of plugins
+ * - InterfaceSidecar: Prebuilt, checksummed methods/events next to a plugin
  * 
  * Example usage:
  * @code
@@ -45,5 +51,15 @@
 
 #include "module_metadata.h"
 #include "logos_module.h"
+#include "interface_table.h"
+#include "json_writer.h"
+#include "metadata_cache.h"
+#include "metadata_index.h"
+#include "module_graph.h"
+#include "interface_sidecar.h"
+#include "memory_usage.h"
+#include "module_watcher.h"
+#include "output_capture.h"
+#include "isolated_introspection.h"
 
 #endif // MODULE_LIB_H
@@ -1,20 +1,162 @@
 #include "module_metadata.h"
+#include "metadata_index.h"
+#include "native_metadata_reader.h"
 #include <QPluginLoader>
+#include <QDir>
+#include <QFileInfo>
+#include <QLibrary>
+#include <QDebug>
 #include <QJsonArray>
 #include <QJsonDocument>
+#include <QJsonParseError>
+#include <algorithm>
+#include <atomic>
+#include <thread>
 
 namespace ModuleLib {
 
-std::optional<ModuleMetadata> ModuleMetadata::fromPath(const QString& pluginPath) {
+namespace {
+// Parse the full Qt plugin metadata object ({ "IID": ..., "MetaData": {...} }).
+// Failures are reported through *errorString rather than logged, so batch
+// readers can attribute them to a file.
+// Without rawMetadataJson (the QPluginLoader path) the text is serialized here.
+std::optional<ModuleMetadata> parsePluginMetadata(const QJsonObject& json, QString* errorString,
+                                                  std::string rawMetadataJson = {}) {
+    QJsonObject customMetadata = json.value("MetaData").toObject();
+    if (customMetadata.isEmpty()) {
+        *errorString = QStringLiteral("No custom metadata (MetaData section) found");
+        return std::nullopt;
+    }
+
+    ModuleMetadata result = rawMetadataJson.empty()
+        ? ModuleMetadata::fromCustomMetadata(customMetadata)
+        : ModuleMetadata::fromCustomMetadata(customMetadata, std::move(rawMetadataJson));
+    if (!result.isValid()) {
+        *errorString = QStringLiteral("Metadata has no module name");
+        return std::nullopt;
+    }
+
+    return result;
+}
+
+std::optional<ModuleMetadata> readPluginMetadata(const QString& pluginPath, QString* errorString) {
+    // Fast path: find and decode the metadata section ourselves. Only when the
+    // file is not a binary we understand do we fall back to QPluginLoader.
+    if (auto native = NativeMetadataReader::read(pluginPath.toStdString())) {
+        QJsonParseError parseError;
+        QJsonDocument doc = QJsonDocument::fromJson(
+            QByteArray::fromStdString(native->metaDataJson), &parseError);
+        if (parseError.error == QJsonParseError::NoError) {
+            QJsonObject json;
+            json["IID"] = QString::fromStdString(native->iid);
+            json["className"] = QString::fromStdString(native->className);
+            json["MetaData"] = doc.object();
+            // The reader writes Qt's compact form: keep its text as is
+            return parsePluginMetadata(json, errorString, std::move(native->metaDataJson));
+        }
+    }
+
     QPluginLoader loader(pluginPath);
     
     QJsonObject metadata = loader.metaData();
     if (metadata.isEmpty()) {
-        qWarning() << "ModuleMetadata: No metadata found for plugin:" << pluginPath;
+        *errorString = QStringLiteral("No metadata found for plugin: ") + pluginPath;
         return std::nullopt;
     }
     
-    return fromJson(metadata);
+    return parsePluginMetadata(metadata, errorString);
+}
+
+// The QString fields fromCustomMetadata() copies, keyed by MetadataFieldKeys
+struct StringField {
+    MetadataField field;
+    QString ModuleMetadata::*member;
+};
+
+constexpr StringField StringFields[] = {
+    {MetadataField::Name, &ModuleMetadata::name},
+    {MetadataField::DisplayName, &ModuleMetadata::displayName},
+    {MetadataField::Version, &ModuleMetadata::version},
+    {MetadataField::Description, &ModuleMetadata::description},
+    {MetadataField::Author, &ModuleMetadata::author},
+    {MetadataField::Type, &ModuleMetadata::type},
+};
+
+// Default fromDirectory() filter: anything the platform considers a shared library.
+bool isPluginFileName(const std::string& fileName) {
+    return QLibrary::isLibrary(QString::fromStdString(fileName));
+}
+} // namespace
+
+std::optional<ModuleMetadata> ModuleMetadata::fromPath(const QString& pluginPath) {
+    QString errorString;
+    auto result = readPluginMetadata(pluginPath, &errorString);
+    if (!result) {
+        qWarning().noquote() << "ModuleMetadata:" << errorString;
+    }
+    return result;
+}
+
+std::vector<MetadataResult> ModuleMetadata::fromPaths(const std::vector<std::string>& pluginPaths,
+                                                      unsigned maxThreads) {
+    std::vector<MetadataResult> results(pluginPaths.size());
+    if (pluginPaths.empty()) {
+        return results;
+    }
+
+    unsigned threadCount = maxThreads ? maxThreads : std::thread::hardware_concurrency();
+    threadCount = std::max(1u, std::min<unsigned>(threadCount, static_cast<unsigned>(pluginPaths.size())));
+
+    // Each worker claims the next unread index, so results land in input order
+    // without any post-sorting and slow files do not stall a fixed partition.
+    std::atomic<std::size_t> next{0};
+    auto worker = [&]() {
+        for (std::size_t i = next++; i < pluginPaths.size(); i = next++) {
+            MetadataResult& result = results[i];
+            result.path = pluginPaths[i];
+
+            const QString path = QString::fromStdString(pluginPaths[i]);
+            result.metadata = MetadataIndex::lookup(path);
+            if (!result.metadata) {
+                QString errorString;
+                result.metadata = readPluginMetadata(path, &errorString);
+                result.error = errorString.toStdString();
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount - 1);
+    for (unsigned t = 1; t < threadCount; ++t) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    return results;
+}
+
+std::vector<MetadataResult> ModuleMetadata::fromDirectory(
+    const std::string& directory,
+    const std::function<bool(const std::string& fileName)>& filter,
+    unsigned maxThreads) {
+    QDir dir(QString::fromStdString(directory));
+    if (!dir.exists()) {
+        return {};
+    }
+
+    std::vector<std::string> pluginPaths;
+    const QFileInfoList entries = dir.entryInfoList(QDir::Files | QDir::NoDotAndDotDot, QDir::Name);
+    for (const QFileInfo& entry : entries) {
+        const std::string fileName = entry.fileName().toStdString();
+        if (filter ? filter(fileName) : isPluginFileName(fileName)) {
+            pluginPaths.push_back(entry.absoluteFilePath().toStdString());
+        }
+    }
+
+    return fromPaths(pluginPaths, maxThreads);
 }
 
 std::optional<ModuleMetadata> ModuleMetadata::fromPath(const std::string& pluginPath) {
@@ -37,20 +179,26 @@ std::optional<ModuleMetadata> ModuleMetadata::fromJson(const QJsonObject& json)
 }
 
 ModuleMetadata ModuleMetadata::fromCustomMetadata(const QJsonObject& customMetadata) {
+    // Qt's serialization, the text every other path supplies as read
+    return fromCustomMetadata(customMetadata,
+                              QJsonDocument(customMetadata).toJson(QJsonDocument::Compact).toStdString());
+}
+
+ModuleMetadata ModuleMetadata::fromCustomMetadata(const QJsonObject& customMetadata,
+                                                  std::string rawMetadataJson) {
     ModuleMetadata result;
     
-    result.name = customMetadata.value("name").toString();
-    result.displayName = customMetadata.value("display_name").toString();
-    result.version = customMetadata.value("version").toString();
-    result.description = customMetadata.value("description").toString();
-    result.author = customMetadata.value("author").toString();
-    result.type = customMetadata.value("type").toString();
+    for (const StringField& field : StringFields) {
+        result.*field.member = customMetadata.value(QLatin1String(metadataKey(field.field))).toString();
+    }
+    const QString protocol = customMetadata
+        .value(QLatin1String(metadataKey(MetadataField::ProtocolVersion))).toString();
+    result.protocolVersion = ProtocolVersion::parse(protocol.toStdString());
     result.rawMetadata = customMetadata;
-    result.rawMetadataJson = QJsonDocument(customMetadata)
-                                 .toJson(QJsonDocument::Compact)
-                                 .toStdString();
+    result.rawMetadataJson = std::move(rawMetadataJson);
     
-    QJsonArray depsArray = customMetadata.value("dependencies").toArray();
+    QJsonArray depsArray = customMetadata
+        .value(QLatin1String(metadataKey(MetadataField::Dependencies))).toArray();
     for (const QJsonValue& dep : depsArray) {
         QString depName = dep.toString();
         if (!depName.isEmpty()) {
@@ -61,4 +209,28 @@ ModuleMetadata ModuleMetadata::fromCustomMetadata(const QJsonObject& customMetad
     return result;
 }
 
+MetadataView MetadataView::fromMetadata(const ModuleMetadata& metadata) {
+    MetadataView view;
+    view.name = metadata.name.toStdString();
+    view.version = metadata.version.toStdString();
+    view.dependencies.reserve(metadata.dependencies.size());
+    for (const QString& dep : metadata.dependencies) {
+        view.dependencies.push_back(dep.toStdString());
+    }
+    view.protocolVersion = metadata.rawMetadata
+        .value(QLatin1String(metadataKey(MetadataField::ProtocolVersion))).toString().toStdString();
+    view.protocol = metadata.protocolVersion;
+    view.rawMetadataJson = metadata.rawMetadataJson;
+    return view;
+}
+
+std::optional<MetadataView> MetadataView::fromPath(std::string_view pluginPath) {
+    auto metadata = ModuleMetadata::fromPath(
+        QString::fromUtf8(pluginPath.data(), static_cast<qsizetype>(pluginPath.size())));
+    if (!metadata) {
+        return std::nullopt;
+    }
+    return metadata->view();
+}
+
 } // namespace ModuleLib
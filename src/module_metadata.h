@@ -4,11 +4,181 @@
 #include <QString>
 #include <QStringList>
 #include <QJsonObject>
+#include <functional>
 #include <optional>
+#include <cstddef>
 #include <string>
+#include <string_view>
+#include <vector>
 
 namespace ModuleLib {
 
+struct ModuleMetadata;
+struct MetadataResult;
+
+/**
+ * @brief ProtocolVersion is a "logos_protocol_version" stamp, parsed once.
+ *
+ * The stamp is "major.minor[.patch]"; anything after the numbers (e.g. a
+ * "-rc1" suffix) is ignored. Pre-protocol builds have no stamp and get an
+ * invalid version, which is compatible with nothing.
+ */
+struct ProtocolVersion {
+    int majorVersion = -1;
+    int minorVersion = 0;
+    int patchVersion = 0;
+
+    constexpr bool isValid() const { return majorVersion >= 0; }
+
+    /**
+     * @brief Check if a module stamped with this version can be used by a
+     *        host speaking protocol @p hostMajor (same major version).
+     */
+    constexpr bool isCompatibleWith(int hostMajor) const {
+        return isValid() && majorVersion == hostMajor;
+    }
+
+    constexpr bool operator==(const ProtocolVersion& other) const {
+        return majorVersion == other.majorVersion && minorVersion == other.minorVersion
+            && patchVersion == other.patchVersion;
+    }
+    constexpr bool operator!=(const ProtocolVersion& other) const { return !(*this == other); }
+
+    /**
+     * @brief Parse a version stamp.
+     *
+     * @return ProtocolVersion The version, invalid if @p text does not start with a number
+     */
+    static constexpr ProtocolVersion parse(std::string_view text) {
+        ProtocolVersion version;
+        int* parts[] = {&version.majorVersion, &version.minorVersion, &version.patchVersion};
+        std::size_t pos = 0;
+        for (int part = 0; part < 3; ++part) {
+            if (part > 0) {
+                if (pos + 1 >= text.size() || text[pos] != '.'
+                    || text[pos + 1] < '0' || text[pos + 1] > '9') {
+                    break;
+                }
+                ++pos;
+            }
+            if (pos >= text.size() || text[pos] < '0' || text[pos] > '9') {
+                return ProtocolVersion();
+            }
+            int value = 0;
+            while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9') {
+                if (value > 99999999) {
+                    return ProtocolVersion();
+                }
+                value = value * 10 + (text[pos] - '0');
+                ++pos;
+            }
+            *parts[part] = value;
+        }
+        return version;
+    }
+};
+
+/**
+ * @brief The well-known fields of a module's metadata.
+ */
+enum class MetadataField {
+    Name,
+    DisplayName,
+    Version,
+    Description,
+    Author,
+    Type,
+    Dependencies,
+    ProtocolVersion
+};
+
+/**
+ * @brief A metadata field and its key in the plugin's "MetaData" object.
+ */
+struct MetadataFieldKey {
+    MetadataField field;
+    const char* key;
+};
+
+/// The keys of the well-known fields; ModuleMetadata::fromCustomMetadata() reads these.
+inline constexpr MetadataFieldKey MetadataFieldKeys[] = {
+    {MetadataField::Name, "name"},
+    {MetadataField::DisplayName, "display_name"},
+    {MetadataField::Version, "version"},
+    {MetadataField::Description, "description"},
+    {MetadataField::Author, "author"},
+    {MetadataField::Type, "type"},
+    {MetadataField::Dependencies, "dependencies"},
+    {MetadataField::ProtocolVersion, "logos_protocol_version"},
+};
+
+/**
+ * @brief The "MetaData" key of a well-known field.
+ */
+constexpr const char* metadataKey(MetadataField field) {
+    for (const MetadataFieldKey& entry : MetadataFieldKeys) {
+        if (entry.field == field) {
+            return entry.key;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @brief Type and ModuleMetadata member of each well-known field, for
+ *        ModuleMetadata::get().
+ */
+template<MetadataField F>
+struct MetadataFieldTraits;
+
+/**
+ * @brief MetadataView is a Qt-free snapshot of a module's identity.
+ *
+ * It carries the fields Qt-free consumers (the package manager, liblogos
+ * core's protocol gate) ask for, produced from a single metadata read. The
+ * LogosModule std::string helpers (getModuleName, getModuleDependencies,
+ * getRawMetadataJson) each extract their one field directly, so a caller
+ * needing several fields should fetch one MetadataView instead of calling
+ * each helper.
+ */
+struct MetadataView {
+    std::string name;
+    std::string version;
+    std::vector<std::string> dependencies;
+
+    // "logos_protocol_version" stamp; empty for pre-protocol builds
+    std::string protocolVersion;
+
+    // The same stamp, parsed
+    ProtocolVersion protocol;
+
+    // The full "MetaData" object as compact JSON (same as ModuleMetadata::rawMetadataJson)
+    std::string rawMetadataJson;
+
+    /**
+     * @brief Check if the view describes a valid module (has at least a name)
+     */
+    bool isValid() const { return !name.empty(); }
+
+    /**
+     * @brief Check if the module speaks protocol major version @p hostMajor.
+     */
+    bool isCompatibleWith(int hostMajor) const { return protocol.isCompatibleWith(hostMajor); }
+
+    /**
+     * @brief Build a view from already-extracted metadata.
+     */
+    static MetadataView fromMetadata(const ModuleMetadata& metadata);
+
+    /**
+     * @brief Read a plugin file once and return its view, without loading it.
+     *
+     * @param pluginPath Path to the plugin file
+     * @return std::optional<MetadataView> The view if extraction succeeded, std::nullopt otherwise
+     */
+    static std::optional<MetadataView> fromPath(std::string_view pluginPath);
+};
+
 /**
  * @brief ModuleMetadata represents the metadata associated with a plugin/module.
  * 
@@ -23,24 +193,54 @@ struct ModuleMetadata {
     QString author;
     QString type;
     QStringList dependencies;
+
+    // Parsed "logos_protocol_version"; invalid for pre-protocol builds
+    ProtocolVersion protocolVersion;
     
     // Raw JSON metadata for any additional fields
     QJsonObject rawMetadata;
 
     // The same raw metadata as a compact JSON string, so Qt-free consumers
-    // (liblogos core's protocol gate) can parse it without QJson.
+    // (liblogos core's protocol gate) can parse it without QJson. Always
+    // QJsonDocument's compact form of rawMetadata, so it does not depend on
+    // how the plugin was read: the native reader and MetadataIndex supply
+    // that text as read, only the QPluginLoader fallback serializes it.
     std::string rawMetadataJson;
 
     /**
      * @brief Check if the metadata is valid (has at least a name)
      */
     bool isValid() const { return !name.isEmpty(); }
+
+    /**
+     * @brief Typed access to a well-known field.
+     *
+     * @code
+     * if (metadata.get<MetadataField::ProtocolVersion>().isCompatibleWith(1)) { ... }
+     * const QString& name = metadata.get<MetadataField::Name>();
+     * @endcode
+     */
+    template<MetadataField F>
+    const typename MetadataFieldTraits<F>::Type& get() const;
+
+    /**
+     * @brief Check if the module speaks protocol major version @p hostMajor.
+     *
+     * An integer comparison on the version parsed at extraction time.
+     */
+    bool isCompatibleWith(int hostMajor) const { return protocolVersion.isCompatibleWith(hostMajor); }
+
+    /**
+     * @brief Get a Qt-free snapshot of this metadata (see MetadataView).
+     */
+    MetadataView view() const { return MetadataView::fromMetadata(*this); }
     
     /**
      * @brief Extract metadata from a plugin file without fully loading it.
      * 
-     * This uses QPluginLoader::metaData() to read the embedded JSON metadata
-     * from the plugin binary.
+     * The embedded metadata is read straight out of the ELF / Mach-O binary
+     * by NativeMetadataReader; files it does not recognise fall back to
+     * QPluginLoader::metaData().
      * 
      * @param pluginPath Path to the plugin file
      * @return std::optional<ModuleMetadata> The metadata if extraction succeeded, std::nullopt otherwise
@@ -55,6 +255,36 @@ struct ModuleMetadata {
      */
     static std::optional<ModuleMetadata> fromPath(const std::string& pluginPath);
     
+    /**
+     * @brief Extract metadata from many plugin files in parallel.
+     *
+     * The reads are spread across a pool of worker threads. Results come back
+     * in input order, one per path, each carrying either the metadata or the
+     * reason it could not be read; nothing is logged. Plugins with a fresh
+     * entry in their directory's MetadataIndex are served from it.
+     *
+     * @param pluginPaths Paths to the plugin files
+     * @param maxThreads  Upper bound on worker threads (0 = one per hardware thread)
+     * @return std::vector<MetadataResult> One result per input path, in input order
+     */
+    static std::vector<MetadataResult> fromPaths(const std::vector<std::string>& pluginPaths,
+                                                 unsigned maxThreads = 0);
+
+    /**
+     * @brief Extract metadata from every plugin file in a directory, in parallel.
+     *
+     * @param directory  The module directory (not searched recursively)
+     * @param filter     Selects files by name; defaults to shared-library names
+     *                   for the platform (.so / .dylib / .dll)
+     * @param maxThreads Upper bound on worker threads (0 = one per hardware thread)
+     * @return std::vector<MetadataResult> One result per selected file, sorted by file name;
+     *         empty if the directory does not exist
+     */
+    static std::vector<MetadataResult> fromDirectory(
+        const std::string& directory,
+        const std::function<bool(const std::string& fileName)>& filter = {},
+        unsigned maxThreads = 0);
+    
     /**
      * @brief Create ModuleMetadata from a QJsonObject.
      * 
@@ -75,6 +305,57 @@ struct ModuleMetadata {
      * @return ModuleMetadata The parsed metadata (may be invalid if required fields missing)
      */
     static ModuleMetadata fromCustomMetadata(const QJsonObject& customMetadata);
+
+    /**
+     * @brief Create ModuleMetadata from the custom metadata section and its
+     *        source text, taking the text as rawMetadataJson without
+     *        serializing the object again.
+     *
+     * @p rawMetadataJson must be QJsonDocument's compact form of
+     * @p customMetadata, as the native reader and MetadataIndex produce.
+     *
+     * @param customMetadata  The custom metadata JSON object
+     * @param rawMetadataJson The same object as compact JSON
+     * @return ModuleMetadata The parsed metadata (may be invalid if required fields missing)
+     */
+    static ModuleMetadata fromCustomMetadata(const QJsonObject& customMetadata, std::string rawMetadataJson);
+};
+
+#define LOGOS_METADATA_FIELD_TRAITS(FIELD, TYPE, MEMBER)                  \
+    template<>                                                             \
+    struct MetadataFieldTraits<MetadataField::FIELD> {                     \
+        using Type = TYPE;                                                 \
+        static constexpr TYPE ModuleMetadata::*member = &ModuleMetadata::MEMBER; \
+    };
+
+LOGOS_METADATA_FIELD_TRAITS(Name, QString, name)
+LOGOS_METADATA_FIELD_TRAITS(DisplayName, QString, displayName)
+LOGOS_METADATA_FIELD_TRAITS(Version, QString, version)
+LOGOS_METADATA_FIELD_TRAITS(Description, QString, description)
+LOGOS_METADATA_FIELD_TRAITS(Author, QString, author)
+LOGOS_METADATA_FIELD_TRAITS(Type, QString, type)
+LOGOS_METADATA_FIELD_TRAITS(Dependencies, QStringList, dependencies)
+LOGOS_METADATA_FIELD_TRAITS(ProtocolVersion, ProtocolVersion, protocolVersion)
+
+#undef LOGOS_METADATA_FIELD_TRAITS
+
+template<MetadataField F>
+const typename MetadataFieldTraits<F>::Type& ModuleMetadata::get() const {
+    return this->*MetadataFieldTraits<F>::member;
+}
+
+/**
+ * @brief MetadataResult is the outcome of reading one file in a batch
+ *        (see ModuleMetadata::fromPaths / fromDirectory).
+ */
+struct MetadataResult {
+    std::string path;
+    std::optional<ModuleMetadata> metadata;
+
+    // Why the metadata could not be read; empty on success
+    std::string error;
+
+    bool ok() const { return metadata.has_value(); }
 };
 
 } // namespace ModuleLib
@@ -0,0 +1,215 @@
+#include "module_watcher.h"
+#include "metadata_cache.h"
+#include <QDir>
+#include <QFileInfo>
+#include <QLibrary>
+#include <QDebug>
+#include <algorithm>
+#include <utility>
+
+namespace ModuleLib {
+
+ModuleWatcher::ModuleWatcher(QObject* parent)
+    : ModuleWatcher(MetadataCache::global(), parent)
+{
+}
+
+ModuleWatcher::ModuleWatcher(MetadataCache& cache, QObject* parent)
+    : QObject(parent)
+    , m_cache(cache)
+{
+    m_settleTimer.setSingleShot(true);
+    m_settleTimer.setInterval(DefaultSettleIntervalMs);
+    connect(&m_settleTimer, &QTimer::timeout, this, &ModuleWatcher::processPending);
+    connect(&m_watcher, &QFileSystemWatcher::directoryChanged,
+            this, &ModuleWatcher::onDirectoryChanged);
+    connect(&m_watcher, &QFileSystemWatcher::fileChanged,
+            this, &ModuleWatcher::onFileChanged);
+}
+
+ModuleWatcher::~ModuleWatcher() = default;
+
+bool ModuleWatcher::addDirectory(const QString& directory) {
+    const QFileInfo info(directory);
+    if (!info.isDir()) {
+        qWarning() << "ModuleWatcher: Not a directory:" << directory;
+        return false;
+    }
+    const QString absolutePath = info.absoluteFilePath();
+    if (m_directories.contains(absolutePath)) {
+        return true;
+    }
+
+    m_directories.insert(absolutePath);
+    if (!m_watcher.addPath(absolutePath)) {
+        qWarning() << "ModuleWatcher: No change notifications for" << absolutePath
+                   << "- use rescan()";
+    }
+    scanDirectory(absolutePath);
+    return true;
+}
+
+bool ModuleWatcher::addDirectory(const std::string& directory) {
+    return addDirectory(QString::fromStdString(directory));
+}
+
+void ModuleWatcher::removeDirectory(const QString& directory) {
+    const QString absolutePath = QFileInfo(directory).absoluteFilePath();
+    if (!m_directories.remove(absolutePath)) {
+        return;
+    }
+    m_watcher.removePath(absolutePath);
+    m_pendingDirectories.remove(absolutePath);
+
+    for (auto it = m_modules.begin(); it != m_modules.end();) {
+        if (it->directory == absolutePath) {
+            m_watcher.removePath(it.key());
+            m_pendingFiles.remove(it.key());
+            it = m_modules.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+QStringList ModuleWatcher::directories() const {
+    QStringList result(m_directories.begin(), m_directories.end());
+    result.sort();
+    return result;
+}
+
+QStringList ModuleWatcher::modulePaths() const {
+    QStringList result = m_modules.keys();
+    result.sort();
+    return result;
+}
+
+std::optional<ModuleMetadata> ModuleWatcher::metadata(const QString& pluginPath) const {
+    auto it = m_modules.constFind(QFileInfo(pluginPath).absoluteFilePath());
+    if (it == m_modules.constEnd()) {
+        return std::nullopt;
+    }
+    return it->metadata;
+}
+
+int ModuleWatcher::settleInterval() const {
+    return m_settleTimer.interval();
+}
+
+void ModuleWatcher::setSettleInterval(int milliseconds) {
+    m_settleTimer.setInterval(std::max(0, milliseconds));
+}
+
+void ModuleWatcher::rescan() {
+    m_settleTimer.stop();
+    m_pendingDirectories = m_directories;
+    processPending();
+}
+
+void ModuleWatcher::onDirectoryChanged(const QString& directory) {
+    m_pendingDirectories.insert(directory);
+    m_settleTimer.start();
+}
+
+void ModuleWatcher::onFileChanged(const QString& path) {
+    m_pendingFiles.insert(path);
+    m_settleTimer.start();
+}
+
+void ModuleWatcher::processPending() {
+    const QSet<QString> directories = std::exchange(m_pendingDirectories, {});
+    QSet<QString> files = std::exchange(m_pendingFiles, {});
+
+    // A directory scan re-stats all of its known plugins
+    for (const QString& directory : directories) {
+        if (m_directories.contains(directory)) {
+            scanDirectory(directory);
+        }
+    }
+    for (const QString& path : files) {
+        auto it = m_modules.constFind(path);
+        if (it != m_modules.constEnd() && !directories.contains(it->directory)) {
+            checkModule(path);
+        }
+    }
+}
+
+void ModuleWatcher::scanDirectory(const QString& directory) {
+    QSet<QString> present;
+    const QFileInfoList entries = QDir(directory).entryInfoList(QDir::Files, QDir::Name);
+    for (const QFileInfo& entry : entries) {
+        if (!QLibrary::isLibrary(entry.fileName())) {
+            continue;
+        }
+        const QString path = entry.absoluteFilePath();
+        present.insert(path);
+
+        if (m_modules.contains(path)) {
+            checkModule(path);
+            continue;
+        }
+        const auto identity = FileIdentity::of(path.toStdString());
+        if (!identity) {
+            continue;
+        }
+        Module& module = m_modules[path];
+        module.directory = directory;
+        module.identity = *identity;
+        readModule(path, module);
+        m_watcher.addPath(path);
+        emit moduleAdded(path);
+    }
+
+    QStringList gone;
+    for (auto it = m_modules.constBegin(); it != m_modules.constEnd(); ++it) {
+        if (it->directory == directory && !present.contains(it.key())) {
+            gone.append(it.key());
+        }
+    }
+    for (const QString& path : gone) {
+        forgetModule(path);
+        emit moduleRemoved(path);
+    }
+}
+
+void ModuleWatcher::checkModule(const QString& path) {
+    auto it = m_modules.find(path);
+    if (it == m_modules.end()) {
+        return;
+    }
+    const auto identity = FileIdentity::of(path.toStdString());
+    if (!identity) {
+        forgetModule(path);
+        emit moduleRemoved(path);
+        return;
+    }
+
+    if (*identity == it->identity) {
+        return;
+    }
+
+    // A file replaced by rename is no longer watched under its path
+    if (identity->inode != it->identity.inode || identity->device != it->identity.device) {
+        m_watcher.removePath(path);
+        m_watcher.addPath(path);
+    }
+    it->identity = *identity;
+    readModule(path, *it);
+    emit moduleChanged(path);
+}
+
+void ModuleWatcher::readModule(const QString& path, Module& module) {
+    module.metadata = m_cache.get(path);
+    if (!module.metadata) {
+        qWarning() << "ModuleWatcher: No readable metadata in" << path;
+    }
+}
+
+void ModuleWatcher::forgetModule(const QString& path) {
+    m_modules.remove(path);
+    m_pendingFiles.remove(path);
+    m_watcher.removePath(path);
+    m_cache.invalidate(path);
+}
+
+} // namespace ModuleLib
@@ -0,0 +1,166 @@
+#ifndef MODULE_WATCHER_H
+#define MODULE_WATCHER_H
+
+#include "file_identity.h"
+#include "module_metadata.h"
+#include <QFileSystemWatcher>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+#include <optional>
+
+namespace ModuleLib {
+
+class MetadataCache;
+
+/**
+ * @brief ModuleWatcher reports plugins appearing, changing and disappearing
+ *        in a set of module directories.
+ *
+ * The watcher keeps the FileIdentity of every plugin file (QLibrary::isLibrary)
+ * in its directories and is notified of changes by QFileSystemWatcher
+ * (inotify, FSEvents, ...). Notifications are coalesced for settleInterval()
+ * milliseconds, so a plugin being rewritten by a build is reported once;
+ * the directories and files they name are then re-stat'ed and only the
+ * plugins whose identity changed have their metadata read again. Metadata
+ * is read through a MetadataCache (MetadataCache::global() by default).
+ * LogosModule::extractMetadata() only consults the global cache once
+ * MetadataCache::global().setEnabled(true) has been called (it is off by
+ * default); with it enabled, extractMetadata() calls made when a signal
+ * fires are served without another read.
+ *
+ * Signals are emitted from the thread the watcher lives in, which needs a
+ * running event loop; rescan() checks every directory synchronously
+ * instead, e.g. where file notifications are unavailable.
+ *
+ * Example usage:
+ * @code
+ * ModuleWatcher watcher;
+ * watcher.addDirectory(modulesDir);
+ * QObject::connect(&watcher, &ModuleWatcher::moduleChanged, [&](const QString& path) {
+ *     modules[path].reload();
+ * });
+ * @endcode
+ */
+class ModuleWatcher : public QObject {
+    Q_OBJECT
+
+public:
+    /// Default time notifications are coalesced for, in milliseconds.
+    static constexpr int DefaultSettleIntervalMs = 200;
+
+    explicit ModuleWatcher(QObject* parent = nullptr);
+
+    /**
+     * @brief Watch through a specific metadata cache instead of MetadataCache::global().
+     */
+    explicit ModuleWatcher(MetadataCache& cache, QObject* parent = nullptr);
+
+    ~ModuleWatcher() override;
+
+    /**
+     * @brief Start watching a directory.
+     *
+     * The plugins already in the directory are read and reported by
+     * moduleAdded() before this returns.
+     *
+     * @param directory Path to the module directory
+     * @return bool True if the directory exists and is now watched
+     */
+    bool addDirectory(const QString& directory);
+
+    /**
+     * @brief Start watching a directory (std::string overload).
+     */
+    bool addDirectory(const std::string& directory);
+
+    /**
+     * @brief Stop watching a directory, forgetting its plugins without
+     *        reporting them as removed.
+     */
+    void removeDirectory(const QString& directory);
+
+    /**
+     * @brief The watched directories, as absolute paths.
+     */
+    QStringList directories() const;
+
+    /**
+     * @brief The plugin files currently known, as absolute paths, sorted.
+     */
+    QStringList modulePaths() const;
+
+    /**
+     * @brief Metadata of a known plugin file, as last read.
+     *
+     * @param pluginPath Path to the plugin file
+     * @return std::optional<ModuleMetadata> The metadata, or std::nullopt if the file
+     *         is not known or has no readable metadata
+     */
+    std::optional<ModuleMetadata> metadata(const QString& pluginPath) const;
+
+    /**
+     * @brief Time notifications are coalesced for, in milliseconds.
+     */
+    int settleInterval() const;
+    void setSettleInterval(int milliseconds);
+
+    /**
+     * @brief Re-stat every watched directory now and report what changed.
+     *
+     * Pending notifications are handled as part of it.
+     */
+    void rescan();
+
+signals:
+    /**
+     * @brief A plugin file appeared (or was already there when its directory was added).
+     */
+    void moduleAdded(const QString& pluginPath);
+
+    /**
+     * @brief A known plugin file was rewritten or replaced; its metadata has been re-read.
+     */
+    void moduleChanged(const QString& pluginPath);
+
+    /**
+     * @brief A known plugin file was deleted or renamed away.
+     */
+    void moduleRemoved(const QString& pluginPath);
+
+private:
+    struct Module {
+        QString directory;
+        FileIdentity identity;
+        std::optional<ModuleMetadata> metadata;
+    };
+
+    void onDirectoryChanged(const QString& directory);
+    void onFileChanged(const QString& path);
+    void processPending();
+
+    // Compare a directory's plugin files to the known ones and report the differences
+    void scanDirectory(const QString& directory);
+
+    // Re-stat one known plugin file and report a change or removal
+    void checkModule(const QString& path);
+
+    // Read the metadata of a plugin file whose identity is new
+    void readModule(const QString& path, Module& module);
+    void forgetModule(const QString& path);
+
+    MetadataCache& m_cache;
+    QFileSystemWatcher m_watcher;
+    QTimer m_settleTimer;
+    QSet<QString> m_directories;
+    QHash<QString, Module> m_modules;
+    QSet<QString> m_pendingDirectories;
+    QSet<QString> m_pendingFiles;
+};
+
+} // namespace ModuleLib
+
+#endif // MODULE_WATCHER_H
@@ -0,0 +1,787 @@
+#include "native_metadata_reader.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ModuleLib {
+namespace NativeMetadataReader {
+
+namespace {
+
+// Layout of the payload as emitted by moc (see QPluginMetaData in qplugin.h):
+// an optional "QTMETADATA !" magic, a 4-byte header (format version, Qt
+// major, Qt minor, architecture requirements), then the CBOR map.
+constexpr char kMagic[] = "QTMETADATA !";
+constexpr std::size_t kMagicSize = sizeof(kMagic) - 1;
+constexpr std::size_t kHeaderSize = 4;
+
+// ELF note carrying the payload (Qt >= 6.3 on ELF platforms).
+constexpr char kElfNoteName[] = "qt-project!";
+constexpr std::uint32_t kElfNoteTypePrefix = 0x7451;  // 'tQ'
+
+// Top-level integer keys of the CBOR map (QtPluginMetaDataKeys).
+constexpr std::uint64_t kKeyIid = 2;
+constexpr std::uint64_t kKeyClassName = 3;
+constexpr std::uint64_t kKeyMetaData = 4;
+
+constexpr int kMaxDepth = 64;
+
+void setError(std::string* errorString, const char* message) {
+    if (errorString) {
+        *errorString = message;
+    }
+}
+
+// Bounds-checked, endian-aware reads from a byte range.
+class Bytes {
+public:
+    Bytes(const unsigned char* data, std::size_t size, bool bigEndian)
+        : m_data(data), m_size(size), m_bigEndian(bigEndian) {}
+
+    bool has(std::uint64_t offset, std::uint64_t length) const {
+        return offset <= m_size && length <= m_size - offset;
+    }
+
+    const unsigned char* at(std::uint64_t offset) const { return m_data + offset; }
+
+    std::uint16_t u16(std::uint64_t offset) const {
+        return static_cast<std::uint16_t>(read(offset, 2));
+    }
+    std::uint32_t u32(std::uint64_t offset) const {
+        return static_cast<std::uint32_t>(read(offset, 4));
+    }
+    std::uint64_t u64(std::uint64_t offset) const { return read(offset, 8); }
+
+private:
+    // Callers check has() first; a read past the end yields 0 rather than
+    // touching memory outside the mapping.
+    std::uint64_t read(std::uint64_t offset, int width) const {
+        std::uint64_t value = 0;
+        if (!has(offset, static_cast<std::uint64_t>(width))) {
+            return value;
+        }
+        for (int i = 0; i < width; ++i) {
+            const int shift = m_bigEndian ? (width - 1 - i) * 8 : i * 8;
+            value |= static_cast<std::uint64_t>(m_data[offset + i]) << shift;
+        }
+        return value;
+    }
+
+    const unsigned char* m_data;
+    std::size_t m_size;
+    bool m_bigEndian;
+};
+
+struct Payload {
+    const unsigned char* data = nullptr;
+    std::size_t size = 0;
+};
+
+// Skip the format header (and the magic, when present) in front of the CBOR.
+bool stripHeader(const unsigned char* data, std::size_t size, bool hasMagic, Payload* payload) {
+    std::size_t skip = kHeaderSize;
+    if (hasMagic) {
+        if (size < kMagicSize || std::memcmp(data, kMagic, kMagicSize) != 0) {
+            return false;
+        }
+        skip += kMagicSize;
+    }
+    if (size <= skip) {
+        return false;
+    }
+    payload->data = data + skip;
+    payload->size = size - skip;
+    return true;
+}
+
+// ---------------------------------------------------------------------------
+// ELF
+// ---------------------------------------------------------------------------
+
+bool findInElfNotes(const Bytes& file, std::uint64_t offset, std::uint64_t size, Payload* payload) {
+    const std::size_t nameSize = sizeof(kElfNoteName);
+    std::uint64_t pos = offset;
+    const std::uint64_t end = offset + size;
+    while (pos + 12 <= end) {
+        const std::uint32_t namesz = file.u32(pos);
+        const std::uint32_t descsz = file.u32(pos + 4);
+        const std::uint32_t type = file.u32(pos + 8);
+        const std::uint64_t nameOffset = pos + 12;
+        const std::uint64_t descOffset = nameOffset + ((namesz + 3u) & ~3ull);
+        if (descOffset > end || descsz > end - descOffset) {
+            return false;
+        }
+        if (namesz == nameSize && (type >> 16) == kElfNoteTypePrefix
+            && std::memcmp(file.at(nameOffset), kElfNoteName, nameSize) == 0) {
+            return stripHeader(file.at(descOffset), descsz, /*hasMagic=*/false, payload);
+        }
+        pos = descOffset + ((descsz + 3ull) & ~3ull);
+    }
+    return false;
+}
+
+bool findInElf(const unsigned char* data, std::size_t size, Payload* payload, std::string* errorString) {
+    if (size < 0x34) {
+        setError(errorString, "Truncated ELF header");
+        return false;
+    }
+    const bool is64 = data[4] == 2;
+    const bool bigEndian = data[5] == 2;
+    const Bytes file(data, size, bigEndian);
+    if (is64 && !file.has(0, 0x40)) {
+        setError(errorString, "Truncated ELF header");
+        return false;
+    }
+
+    const std::uint64_t shoff = is64 ? file.u64(0x28) : file.u32(0x20);
+    const std::uint16_t shentsize = file.u16(is64 ? 0x3A : 0x2E);
+    std::uint64_t shnum = file.u16(is64 ? 0x3C : 0x30);
+    std::uint64_t shstrndx = file.u16(is64 ? 0x3E : 0x32);
+    const std::uint64_t minEntSize = is64 ? 0x40 : 0x28;
+    if (shoff == 0 || shentsize < minEntSize || !file.has(shoff, shentsize)) {
+        setError(errorString, "ELF file has no section headers");
+        return false;
+    }
+
+    auto sectionOffset = [&](std::uint64_t s) { return is64 ? file.u64(s + 0x18) : file.u32(s + 0x10); };
+    auto sectionSize = [&](std::uint64_t s) { return is64 ? file.u64(s + 0x20) : file.u32(s + 0x14); };
+    constexpr std::uint32_t kShtNobits = 8;
+
+    // Extended numbering: the real values live in section header 0.
+    if (shnum == 0) {
+        shnum = sectionSize(shoff);
+    }
+    if (shstrndx == 0xffff) {
+        shstrndx = file.u32(shoff + (is64 ? 0x28 : 0x18));
+    }
+    if (shnum == 0 || shnum > size / shentsize || shstrndx >= shnum
+        || !file.has(shoff, shnum * shentsize)) {
+        setError(errorString, "Malformed ELF section headers");
+        return false;
+    }
+
+    const std::uint64_t strtab = shoff + shstrndx * shentsize;
+    const std::uint64_t strOffset = sectionOffset(strtab);
+    const std::uint64_t strSize = sectionSize(strtab);
+    if (!file.has(strOffset, strSize)) {
+        setError(errorString, "Malformed ELF section name table");
+        return false;
+    }
+
+    for (std::uint64_t i = 0; i < shnum; ++i) {
+        const std::uint64_t sh = shoff + i * shentsize;
+        const std::uint32_t nameIndex = file.u32(sh);
+        if (nameIndex >= strSize || file.u32(sh + 4) == kShtNobits) {
+            continue;
+        }
+        const char* name = reinterpret_cast<const char*>(file.at(strOffset + nameIndex));
+        const std::size_t maxLen = static_cast<std::size_t>(strSize - nameIndex);
+        const bool isNote = strncmp(name, ".note.qt.metadata", maxLen) == 0;
+        const bool isSection = strncmp(name, ".qtmetadata", maxLen) == 0;
+        if (!isNote && !isSection) {
+            continue;
+        }
+
+        const std::uint64_t offset = sectionOffset(sh);
+        const std::uint64_t length = sectionSize(sh);
+        if (!file.has(offset, length)) {
+            setError(errorString, "Qt metadata section lies outside the file");
+            return false;
+        }
+        const bool found = isNote
+            ? findInElfNotes(file, offset, length, payload)
+            : stripHeader(file.at(offset), static_cast<std::size_t>(length), /*hasMagic=*/true, payload);
+        if (found) {
+            return true;
+        }
+    }
+
+    setError(errorString, "No Qt plugin metadata section found");
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// Mach-O
+// ---------------------------------------------------------------------------
+
+constexpr std::uint32_t kMhMagic = 0xfeedface;
+constexpr std::uint32_t kMhMagic64 = 0xfeedfacf;
+constexpr std::uint32_t kMhCigam = 0xcefaedfe;
+constexpr std::uint32_t kMhCigam64 = 0xcffaedfe;
+constexpr std::uint32_t kFatMagic = 0xcafebabe;
+constexpr std::uint32_t kFatMagic64 = 0xcafebabf;
+constexpr std::uint32_t kLcSegment = 0x1;
+constexpr std::uint32_t kLcSegment64 = 0x19;
+// sizeof(segment_command[_64]) and sizeof(section[_64]) from <mach-o/loader.h>
+constexpr std::uint64_t kSegmentCommandSize = 56;
+constexpr std::uint64_t kSegmentCommand64Size = 72;
+constexpr std::uint64_t kSectionSize = 68;
+constexpr std::uint64_t kSection64Size = 80;
+
+bool fixedNameEquals(const unsigned char* field, const char* name) {
+    // Mach-O names are 16-byte fields, NUL-padded (not terminated when full).
+    return strncmp(reinterpret_cast<const char*>(field), name, 16) == 0;
+}
+
+std::uint32_t hostCpuType() {
+#if defined(__x86_64__) || defined(_M_X64)
+    return 0x01000007;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    return 0x0100000c;
+#elif defined(__i386__) || defined(_M_IX86)
+    return 7;
+#elif defined(__arm__) || defined(_M_ARM)
+    return 12;
+#else
+    return 0;
+#endif
+}
+
+bool findInThinMachO(const unsigned char* data, std::size_t size, Payload* payload, std::string* errorString) {
+    if (size < 28) {
+        setError(errorString, "Truncated Mach-O header");
+        return false;
+    }
+    const std::uint32_t rawMagic = Bytes(data, size, false).u32(0);
+    const bool bigEndian = rawMagic == kMhCigam || rawMagic == kMhCigam64;
+    const bool is64 = rawMagic == kMhMagic64 || rawMagic == kMhCigam64;
+    const Bytes file(data, size, bigEndian);
+
+    const std::uint32_t ncmds = file.u32(16);
+    std::uint64_t pos = is64 ? 32 : 28;
+    for (std::uint32_t c = 0; c < ncmds; ++c) {
+        if (!file.has(pos, 8)) {
+            break;
+        }
+        const std::uint32_t cmd = file.u32(pos);
+        const std::uint32_t cmdsize = file.u32(pos + 4);
+        if (cmdsize < 8 || !file.has(pos, cmdsize)) {
+            break;
+        }
+
+        const bool isSegment = (is64 && cmd == kLcSegment64) || (!is64 && cmd == kLcSegment);
+        const std::uint64_t segmentSize = is64 ? kSegmentCommand64Size : kSegmentCommandSize;
+        if (isSegment && cmdsize < segmentSize) {
+            setError(errorString, "Truncated Mach-O segment command");
+            return false;
+        }
+        if (isSegment && fixedNameEquals(file.at(pos + 8), "__TEXT")) {
+            const std::uint32_t nsects = file.u32(pos + (is64 ? 64 : 48));
+            const std::uint64_t sectSize = is64 ? kSection64Size : kSectionSize;
+            if (nsects > (cmdsize - segmentSize) / sectSize) {
+                setError(errorString, "Mach-O segment sections overrun the command");
+                return false;
+            }
+            std::uint64_t sect = pos + segmentSize;
+            for (std::uint32_t s = 0; s < nsects; ++s, sect += sectSize) {
+                if (!fixedNameEquals(file.at(sect), "qtmetadata")) {
+                    continue;
+                }
+                const std::uint64_t length = is64 ? file.u64(sect + 40) : file.u32(sect + 36);
+                const std::uint64_t offset = file.u32(sect + (is64 ? 48 : 40));
+                if (!file.has(offset, length)) {
+                    setError(errorString, "Qt metadata section lies outside the file");
+                    return false;
+                }
+                return stripHeader(file.at(offset), static_cast<std::size_t>(length),
+                                   /*hasMagic=*/true, payload);
+            }
+        }
+        pos += cmdsize;
+    }
+
+    setError(errorString, "No Qt plugin metadata section found");
+    return false;
+}
+
+bool findInFatMachO(const unsigned char* data, std::size_t size, Payload* payload, std::string* errorString) {
+    // Fat headers are always big-endian.
+    const Bytes file(data, size, true);
+    const bool is64 = file.u32(0) == kFatMagic64;
+    const std::uint32_t narch = file.u32(4);
+    const std::uint64_t entrySize = is64 ? 32 : 20;
+    // 0xcafebabe is also the Java class file magic; real fat files hold few slices.
+    if (narch == 0 || narch > 32 || !file.has(8, narch * entrySize)) {
+        setError(errorString, "Not a Mach-O fat binary");
+        return false;
+    }
+
+    const std::uint32_t host = hostCpuType();
+    for (std::uint32_t i = 0; i < narch; ++i) {
+        const std::uint64_t entry = 8 + i * entrySize;
+        if (file.u32(entry) != host) {
+            continue;
+        }
+        const std::uint64_t offset = is64 ? file.u64(entry + 8) : file.u32(entry + 8);
+        const std::uint64_t length = is64 ? file.u64(entry + 16) : file.u32(entry + 12);
+        if (!file.has(offset, length)) {
+            setError(errorString, "Mach-O slice lies outside the file");
+            return false;
+        }
+        return findInThinMachO(file.at(offset), static_cast<std::size_t>(length), payload, errorString);
+    }
+
+    setError(errorString, "Fat binary has no slice for the host architecture");
+    return false;
+}
+
+// ---------------------------------------------------------------------------
+// CBOR -> JSON
+// ---------------------------------------------------------------------------
+
+class CborToJson {
+public:
+    CborToJson(const unsigned char* data, std::size_t size) : m_data(data), m_size(size) {}
+
+    bool decodeTopLevel(PluginMetaData* result) {
+        Head head;
+        if (!readHead(&head) || head.major != 5) {
+            return false;
+        }
+        for (std::uint64_t i = 0; head.indefinite || i < head.value; ++i) {
+            if (head.indefinite && consumeBreak()) {
+                return true;
+            }
+            Head key;
+            if (!readHead(&key)) {
+                return false;
+            }
+            std::uint64_t keyId = 0;
+            if (key.major == 0) {
+                keyId = key.value;
+            } else if (key.major == 3) {
+                std::string name;
+                if (!readText(key, &name)) {
+                    return false;
+                }
+                keyId = name == "IID" ? kKeyIid
+                      : name == "className" ? kKeyClassName
+                      : name == "MetaData" ? kKeyMetaData : 0;
+            } else {
+                return false;
+            }
+
+            if (keyId == kKeyIid || keyId == kKeyClassName) {
+                Head value;
+                std::string text;
+                if (!readHead(&value) || value.major != 3 || !readText(value, &text)) {
+                    return false;
+                }
+                (keyId == kKeyIid ? result->iid : result->className) = std::move(text);
+            } else if (keyId == kKeyMetaData) {
+                result->metaDataJson.clear();
+                if (!item(&result->metaDataJson, 0)) {
+                    return false;
+                }
+            } else {
+                std::string ignored;
+                if (!item(&ignored, 0)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    struct Head {
+        int major = 0;
+        int info = 0;
+        std::uint64_t value = 0;
+        bool indefinite = false;
+    };
+
+    bool readHead(Head* head) {
+        if (m_pos >= m_size) {
+            return false;
+        }
+        const unsigned char initial = m_data[m_pos++];
+        head->major = initial >> 5;
+        head->info = initial & 0x1f;
+        head->indefinite = false;
+        if (head->info < 24) {
+            head->value = static_cast<std::uint64_t>(head->info);
+            return true;
+        }
+        if (head->info == 31) {
+            head->indefinite = true;
+            head->value = 0;
+            return head->major >= 2;
+        }
+        if (head->info > 27) {
+            return false;
+        }
+        const std::size_t width = std::size_t(1) << (head->info - 24);
+        if (m_size - m_pos < width) {
+            return false;
+        }
+        head->value = 0;
+        for (std::size_t i = 0; i < width; ++i) {
+            head->value = (head->value << 8) | m_data[m_pos++];
+        }
+        return true;
+    }
+
+    bool consumeBreak() {
+        if (m_pos < m_size && m_data[m_pos] == 0xff) {
+            ++m_pos;
+            return true;
+        }
+        return false;
+    }
+
+    // Read a (possibly chunked) byte or text string whose head was just read.
+    bool readText(const Head& head, std::string* out) {
+        if (!head.indefinite) {
+            if (head.value > m_size - m_pos) {
+                return false;
+            }
+            out->append(reinterpret_cast<const char*>(m_data + m_pos), static_cast<std::size_t>(head.value));
+            m_pos += static_cast<std::size_t>(head.value);
+            return true;
+        }
+        while (!consumeBreak()) {
+            Head chunk;
+            if (!readHead(&chunk) || chunk.major != head.major || chunk.indefinite
+                || !readText(chunk, out)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void appendEscaped(std::string* out, const std::string& text) {
+        out->push_back('"');
+        for (unsigned char c : text) {
+            switch (c) {
+            case '"': out->append("\\\""); break;
+            case '\\': out->append("\\\\"); break;
+            case '\b': out->append("\\b"); break;
+            case '\f': out->append("\\f"); break;
+            case '\n': out->append("\\n"); break;
+            case '\r': out->append("\\r"); break;
+            case '\t': out->append("\\t"); break;
+            default:
+                if (c < 0x20) {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                    out->append(buf);
+                } else {
+                    out->push_back(static_cast<char>(c));
+                }
+            }
+        }
+        out->push_back('"');
+    }
+
+    // Byte strings become base64url strings, as QCborValue::toJsonValue() does.
+    static void appendBase64Url(std::string* out, const std::string& bytes) {
+        static const char alphabet[] =
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        out->push_back('"');
+        std::size_t i = 0;
+        for (; i + 2 < bytes.size(); i += 3) {
+            const std::uint32_t n = (std::uint8_t(bytes[i]) << 16) | (std::uint8_t(bytes[i + 1]) << 8)
+                                  | std::uint8_t(bytes[i + 2]);
+            out->push_back(alphabet[(n >> 18) & 63]);
+            out->push_back(alphabet[(n >> 12) & 63]);
+            out->push_back(alphabet[(n >> 6) & 63]);
+            out->push_back(alphabet[n & 63]);
+        }
+        if (i + 1 == bytes.size()) {
+            const std::uint32_t n = std::uint8_t(bytes[i]) << 16;
+            out->push_back(alphabet[(n >> 18) & 63]);
+            out->push_back(alphabet[(n >> 12) & 63]);
+        } else if (i + 2 == bytes.size()) {
+            const std::uint32_t n = (std::uint8_t(bytes[i]) << 16) | (std::uint8_t(bytes[i + 1]) << 8);
+            out->push_back(alphabet[(n >> 18) & 63]);
+            out->push_back(alphabet[(n >> 12) & 63]);
+            out->push_back(alphabet[(n >> 6) & 63]);
+        }
+        out->push_back('"');
+    }
+
+    static void appendDouble(std::string* out, double value) {
+        if (!std::isfinite(value)) {
+            out->append("null");
+            return;
+        }
+        // The shortest form that reads back as the same double, as
+        // QJsonDocument writes it (0.1, not 0.10000000000000001)
+        char buf[32];
+        for (int precision = 1; precision <= 17; ++precision) {
+            std::snprintf(buf, sizeof(buf), "%.*g", precision, value);
+            if (std::strtod(buf, nullptr) == value) {
+                break;
+            }
+        }
+        // Qt applications run with the user's LC_NUMERIC; JSON needs a point
+        for (char* c = buf; *c; ++c) {
+            if (*c == ',') {
+                *c = '.';
+            }
+        }
+        out->append(buf);
+    }
+
+    static double halfToDouble(std::uint16_t half) {
+        const int exponent = (half >> 10) & 0x1f;
+        const int mantissa = half & 0x3ff;
+        double value;
+        if (exponent == 0) {
+            value = std::ldexp(mantissa, -24);
+        } else if (exponent != 31) {
+            value = std::ldexp(mantissa + 1024, exponent - 25);
+        } else {
+            value = mantissa == 0 ? INFINITY : NAN;
+        }
+        return (half & 0x8000) ? -value : value;
+    }
+
+    // Decode one data item and append its JSON rendering.
+    bool item(std::string* out, int depth) {
+        if (depth > kMaxDepth) {
+            return false;
+        }
+        Head head;
+        if (!readHead(&head)) {
+            return false;
+        }
+
+        switch (head.major) {
+        // Integers outside qint64 become doubles, as in QCborValue
+        case 0:
+            if (head.value > static_cast<std::uint64_t>(INT64_MAX)) {
+                appendDouble(out, static_cast<double>(head.value));
+            } else {
+                out->append(std::to_string(head.value));
+            }
+            return true;
+        case 1:
+            if (head.value > static_cast<std::uint64_t>(INT64_MAX)) {
+                appendDouble(out, -1.0 - static_cast<double>(head.value));
+            } else {
+                out->append(std::to_string(-1 - static_cast<std::int64_t>(head.value)));
+            }
+            return true;
+        case 2:
+        case 3: {
+            std::string text;
+            if (!readText(head, &text)) {
+                return false;
+            }
+            if (head.major == 2) {
+                appendBase64Url(out, text);
+            } else {
+                appendEscaped(out, text);
+            }
+            return true;
+        }
+        case 4:
+            out->push_back('[');
+            for (std::uint64_t i = 0; head.indefinite || i < head.value; ++i) {
+                if (head.indefinite && consumeBreak()) {
+                    break;
+                }
+                if (i > 0) {
+                    out->push_back(',');
+                }
+                if (!item(out, depth + 1)) {
+                    return false;
+                }
+            }
+            out->push_back(']');
+            return true;
+        case 5: {
+            // Members in QJsonObject's order: sorted by key (code point order,
+            // which is UTF-8 byte order), the last of duplicate keys kept
+            std::vector<std::pair<std::string, std::string>> members;
+            for (std::uint64_t i = 0; head.indefinite || i < head.value; ++i) {
+                if (head.indefinite && consumeBreak()) {
+                    break;
+                }
+                std::pair<std::string, std::string> member;
+                if (!key(&member.first, depth + 1) || !item(&member.second, depth + 1)) {
+                    return false;
+                }
+                members.push_back(std::move(member));
+            }
+            std::stable_sort(members.begin(), members.end(),
+                             [](const auto& a, const auto& b) { return a.first < b.first; });
+            out->push_back('{');
+            bool first = true;
+            for (std::size_t i = 0; i < members.size(); ++i) {
+                if (i + 1 < members.size() && members[i + 1].first == members[i].first) {
+                    continue;
+                }
+                if (!first) {
+                    out->push_back(',');
+                }
+                first = false;
+                appendEscaped(out, members[i].first);
+                out->push_back(':');
+                out->append(members[i].second);
+            }
+            out->push_back('}');
+            return true;
+        }
+        case 6:
+            // Tags only refine the meaning of the tagged item; keep the item.
+            return item(out, depth + 1);
+        default:
+            break;
+        }
+
+        // Major type 7: simple values and floats.
+        switch (head.info) {
+        case 20: out->append("false"); return true;
+        case 21: out->append("true"); return true;
+        case 25: appendDouble(out, halfToDouble(static_cast<std::uint16_t>(head.value))); return true;
+        case 26: {
+            const std::uint32_t bits = static_cast<std::uint32_t>(head.value);
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            appendDouble(out, value);
+            return true;
+        }
+        case 27: {
+            double value;
+            std::memcpy(&value, &head.value, sizeof(value));
+            appendDouble(out, value);
+            return true;
+        }
+        case 31:
+            return false;  // unexpected break
+        default:
+            out->append("null");  // null, undefined and unassigned simple values
+            return true;
+        }
+    }
+
+    // Read a map key as unescaped text. Keys must be strings in JSON; other
+    // key types are stringified.
+    bool key(std::string* text, int depth) {
+        const std::size_t start = m_pos;
+        Head head;
+        if (!readHead(&head)) {
+            return false;
+        }
+        if (head.major == 3) {
+            return readText(head, text);
+        }
+        m_pos = start;
+        return item(text, depth);
+    }
+
+    const unsigned char* m_data;
+    std::size_t m_size;
+    std::size_t m_pos = 0;
+};
+
+#ifndef _WIN32
+class MappedFile {
+public:
+    ~MappedFile() {
+        if (m_data) {
+            munmap(const_cast<unsigned char*>(m_data), m_size);
+        }
+    }
+
+    bool open(const std::string& path, std::string* errorString) {
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            setError(errorString, "Cannot open file");
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0) {
+            ::close(fd);
+            setError(errorString, "Not a regular, non-empty file");
+            return false;
+        }
+        void* mapped = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (mapped == MAP_FAILED) {
+            setError(errorString, "Cannot map file");
+            return false;
+        }
+        m_data = static_cast<const unsigned char*>(mapped);
+        m_size = static_cast<std::size_t>(st.st_size);
+        return true;
+    }
+
+    const unsigned char* data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+
+private:
+    const unsigned char* m_data = nullptr;
+    std::size_t m_size = 0;
+};
+#endif
+
+} // namespace
+
+std::optional<PluginMetaData> decode(const unsigned char* data, std::size_t size, std::string* errorString) {
+    PluginMetaData result;
+    CborToJson decoder(data, size);
+    if (!decoder.decodeTopLevel(&result)) {
+        setError(errorString, "Malformed CBOR plugin metadata");
+        return std::nullopt;
+    }
+    return result;
+}
+
+std::optional<PluginMetaData> read(const std::string& pluginPath, std::string* errorString) {
+#ifdef _WIN32
+    (void)pluginPath;
+    setError(errorString, "Native metadata reading is not supported on this platform");
+    return std::nullopt;
+#else
+    MappedFile file;
+    if (!file.open(pluginPath, errorString)) {
+        return std::nullopt;
+    }
+
+    const unsigned char* data = file.data();
+    const std::size_t size = file.size();
+    if (size < 8) {
+        setError(errorString, "File too small to be a plugin");
+        return std::nullopt;
+    }
+
+    Payload payload;
+    bool found = false;
+    const std::uint32_t magicLE = Bytes(data, size, false).u32(0);
+    const std::uint32_t magicBE = Bytes(data, size, true).u32(0);
+    if (std::memcmp(data, "\x7f" "ELF", 4) == 0) {
+        found = findInElf(data, size, &payload, errorString);
+    } else if (magicLE == kMhMagic || magicLE == kMhMagic64 || magicLE == kMhCigam || magicLE == kMhCigam64) {
+        found = findInThinMachO(data, size, &payload, errorString);
+    } else if (magicBE == kFatMagic || magicBE == kFatMagic64) {
+        found = findInFatMachO(data, size, &payload, errorString);
+    } else {
+        setError(errorString, "Not an ELF or Mach-O file");
+    }
+
+    if (!found) {
+        return std::nullopt;
+    }
+    return decode(payload.data, payload.size, errorString);
+#endif
+}
+
+}  // namespace NativeMetadataReader
+}  // namespace ModuleLib
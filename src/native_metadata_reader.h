@@ -0,0 +1,61 @@
+#ifndef NATIVE_METADATA_READER_H
+#define NATIVE_METADATA_READER_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+/**
+ * @brief Qt-free reader for the metadata Qt embeds in a plugin binary.
+ *
+ * Qt 6 stores a plugin's metadata as a CBOR map in a dedicated part of the
+ * binary: the `.note.qt.metadata` ELF note (or, for older builds, the
+ * `.qtmetadata` ELF section) and the `__TEXT,qtmetadata` Mach-O section.
+ * This reader mmap()s the file, walks only the section headers / load
+ * commands to find that payload, and decodes the CBOR itself — no
+ * QPluginLoader, no library path resolution and no Qt plugin-loader lock,
+ * so it is cheap and safe to call from many threads at once.
+ *
+ * Anything it does not recognise (other formats, fat binaries without a
+ * slice for the host architecture, Windows) yields std::nullopt; callers
+ * are expected to fall back to QPluginLoader (see ModuleMetadata::fromPath).
+ */
+namespace ModuleLib {
+namespace NativeMetadataReader {
+
+struct PluginMetaData {
+    std::string iid;
+    std::string className;
+
+    // The custom "MetaData" object as compact JSON, written the way
+    // QJsonDocument::Compact writes it (sorted keys, shortest doubles), so it
+    // can stand in for Qt's serialization; empty if the plugin has none
+    std::string metaDataJson;
+};
+
+/**
+ * @brief Read the embedded plugin metadata of a file.
+ *
+ * @param pluginPath  Path to the plugin file
+ * @param errorString Optional pointer to receive the reason on failure
+ * @return std::optional<PluginMetaData> The metadata, or std::nullopt if the
+ *         file is not a recognised plugin binary
+ */
+std::optional<PluginMetaData> read(const std::string& pluginPath, std::string* errorString = nullptr);
+
+/**
+ * @brief Decode a Qt plugin metadata CBOR payload (the bytes after the
+ *        format header).
+ *
+ * @param data        Start of the CBOR map
+ * @param size        Number of bytes available
+ * @param errorString Optional pointer to receive the reason on failure
+ * @return std::optional<PluginMetaData> The decoded metadata, or std::nullopt if malformed
+ */
+std::optional<PluginMetaData> decode(const unsigned char* data, std::size_t size,
+                                     std::string* errorString = nullptr);
+
+}  // namespace NativeMetadataReader
+}  // namespace ModuleLib
+
+#endif  // NATIVE_METADATA_READER_H
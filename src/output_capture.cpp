@@ -0,0 +1,102 @@
+#include "output_capture.h"
+#include <mutex>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define LOGOS_OUTPUT_CAPTURE_POSIX 1
+#endif
+
+namespace ModuleLib {
+
+namespace {
+// Recursive so a capture started while loading a plugin in a capture nests
+std::recursive_mutex s_captureMutex;
+} // namespace
+
+#if defined(LOGOS_OUTPUT_CAPTURE_POSIX)
+
+OutputCapture::OutputCapture(Mode mode)
+    : m_mode(mode)
+{
+    s_captureMutex.lock();
+    std::fflush(nullptr);
+
+    int target = -1;
+    if (m_mode == Capture) {
+        m_buffer = std::tmpfile();
+        target = m_buffer ? ::fileno(m_buffer) : -1;
+    } else {
+        target = ::open("/dev/null", O_WRONLY);
+    }
+    if (target == -1) {
+        s_captureMutex.unlock();
+        return;
+    }
+
+    m_savedStdout = ::dup(STDOUT_FILENO);
+    m_savedStderr = ::dup(STDERR_FILENO);
+    ::dup2(target, STDOUT_FILENO);
+    ::dup2(target, STDERR_FILENO);
+    if (m_mode == Discard) {
+        ::close(target);
+    }
+    m_active = true;
+}
+
+OutputCapture::~OutputCapture() {
+    finish();
+}
+
+QByteArray OutputCapture::finish() {
+    if (!m_active) {
+        return QByteArray();
+    }
+    m_active = false;
+    std::fflush(nullptr);
+
+    if (m_savedStdout != -1) {
+        ::dup2(m_savedStdout, STDOUT_FILENO);
+        ::close(m_savedStdout);
+        m_savedStdout = -1;
+    }
+    if (m_savedStderr != -1) {
+        ::dup2(m_savedStderr, STDERR_FILENO);
+        ::close(m_savedStderr);
+        m_savedStderr = -1;
+    }
+    s_captureMutex.unlock();
+
+    QByteArray output;
+    if (m_buffer) {
+        // Written through the descriptor, so read it back the same way
+        const int fd = ::fileno(m_buffer);
+        if (::lseek(fd, 0, SEEK_SET) == 0) {
+            char chunk[4096];
+            ssize_t count = 0;
+            while ((count = ::read(fd, chunk, sizeof(chunk))) > 0) {
+                output.append(chunk, static_cast<qsizetype>(count));
+            }
+        }
+        std::fclose(m_buffer);
+        m_buffer = nullptr;
+    }
+    return output;
+}
+
+#else
+
+OutputCapture::OutputCapture(Mode mode)
+    : m_mode(mode)
+{
+}
+
+OutputCapture::~OutputCapture() = default;
+
+QByteArray OutputCapture::finish() {
+    return QByteArray();
+}
+
+#endif
+
+} // namespace ModuleLib
@@ -0,0 +1,81 @@
+#ifndef OUTPUT_CAPTURE_H
+#define OUTPUT_CAPTURE_H
+
+#include <QByteArray>
+#include <cstdio>
+
+namespace ModuleLib {
+
+/**
+ * @brief OutputCapture redirects the process's stdout and stderr file
+ *        descriptors while it is active, capturing or discarding what is
+ *        written to them.
+ *
+ * Plugin constructors and static initializers print straight to the file
+ * descriptors (printf, std::cout, qDebug), so they can only be silenced at
+ * that level. The descriptors are process-wide: captures are serialized
+ * behind one process-wide lock, so concurrent captures never restore each
+ * other's descriptors, and a capture started from inside another one (a
+ * plugin loading a plugin) nests. Output written by other threads while a
+ * capture is active lands in it as well.
+ *
+ * Captured output is buffered in an anonymous temporary file, so a plugin
+ * printing a lot never blocks on a full pipe. On platforms without POSIX
+ * file descriptors, nothing is redirected.
+ *
+ * Example usage:
+ * @code
+ * QByteArray output;
+ * {
+ *     OutputCapture capture(OutputCapture::Capture);
+ *     plugin = LogosModule::loadFromPath(path);
+ *     output = capture.finish();
+ * }
+ * @endcode
+ */
+class OutputCapture {
+public:
+    enum Mode {
+        Discard,   ///< Send the output to the null device
+        Capture    ///< Keep the output; finish() returns it
+    };
+
+    /**
+     * @brief Flush stdio and start redirecting, waiting for any capture
+     *        running in another thread to finish.
+     */
+    explicit OutputCapture(Mode mode = Capture);
+
+    /**
+     * @brief Restore the descriptors if finish() was not called.
+     */
+    ~OutputCapture();
+
+    OutputCapture(const OutputCapture&) = delete;
+    OutputCapture& operator=(const OutputCapture&) = delete;
+
+    /**
+     * @brief Flush stdio, restore the descriptors and release the lock.
+     *
+     * @return QByteArray What was written while the capture was active
+     *         (stdout and stderr interleaved), or empty in Discard mode and
+     *         on later calls
+     */
+    QByteArray finish();
+
+    /**
+     * @brief Check if the descriptors are currently redirected by this capture.
+     */
+    bool isActive() const { return m_active; }
+
+private:
+    Mode m_mode;
+    bool m_active = false;
+    int m_savedStdout = -1;
+    int m_savedStderr = -1;
+    std::FILE* m_buffer = nullptr;
+};
+
+} // namespace ModuleLib
+
+#endif // OUTPUT_CAPTURE_H
@@ -5,6 +5,7 @@
 #include <array>
 #include <memory>
 #include <vector>
+#include <unistd.h>
 
 // =============================================================================
 // CLI Test Fixture
@@ -197,6 +198,14 @@ TEST_F(CLITest, MethodsHelp_ShowsCommandHelp) {
     EXPECT_NE(result.output.find("--json"), std::string::npos);
 }
 
+TEST_F(CLITest, IndexHelp_ShowsCommandHelp) {
+    auto result = runCommand("index --help");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("lm index"), std::string::npos);
+    EXPECT_NE(result.output.find(".logos-module-index.json"), std::string::npos);
+}
+
 // =============================================================================
 // Error Handling Tests
 // =============================================================================
@@ -225,6 +234,20 @@ TEST_F(CLITest, MethodsMissingPath_ReturnsError) {
     EXPECT_NE(result.output.find("Missing plugin path"), std::string::npos);
 }
 
+TEST_F(CLITest, IndexMissingDirectory_ReturnsError) {
+    auto result = runCommand("index");
+    
+    EXPECT_NE(result.exitCode, 0);
+    EXPECT_NE(result.output.find("Missing module directory"), std::string::npos);
+}
+
+TEST_F(CLITest, IndexNonExistentDirectory_ReturnsError) {
+    auto result = runCommand("index /nonexistent/modules/dir");
+    
+    EXPECT_NE(result.exitCode, 0);
+    EXPECT_NE(result.output.find("not found"), std::string::npos);
+}
+
 TEST_F(CLITest, NonExistentPlugin_ReturnsError) {
     auto result = runCommand("metadata /nonexistent/path/plugin.so");
     
@@ -406,3 +429,296 @@ TEST_F(CLIPluginTest, Methods_JsonAllMethodsInvokable) {
     // All methods should be invokable
     EXPECT_NE(result.output.find("\"isInvokable\": true"), std::string::npos);
 }
+
+// =============================================================================
+// Real Plugin Tests - Default (info) Mode
+// =============================================================================
+
+TEST_F(CLIPluginTest, Info_ShowsAllSections) {
+    auto result = runCommand(testPlugin);
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("Plugin Metadata:"), std::string::npos);
+    EXPECT_NE(result.output.find("Name:         package_manager"), std::string::npos);
+    EXPECT_NE(result.output.find("Signature: installPlugin(QString)"), std::string::npos);
+    EXPECT_NE(result.output.find("Plugin Events:"), std::string::npos);
+    // Sections appear in order: metadata, methods, events
+    EXPECT_LT(result.output.find("Plugin Metadata:"), result.output.find("installPlugin"));
+    EXPECT_LT(result.output.find("installPlugin"), result.output.find("Plugin Events:"));
+}
+
+TEST_F(CLIPluginTest, Info_JsonHasAllSections) {
+    auto result = runCommand(testPlugin + " --json");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("\"metadata\": {"), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\": \"package_manager\""), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\": \"installPlugin\""), std::string::npos);
+    EXPECT_NE(result.output.find("\"events\": ["), std::string::npos);
+}
+
+// =============================================================================
+// Scan Command
+// =============================================================================
+
+TEST_F(CLITest, ScanHelp_ShowsCommandHelp) {
+    auto result = runCommand("scan --help");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("Usage: lm scan"), std::string::npos);
+    EXPECT_NE(result.output.find("--metadata-only"), std::string::npos);
+    EXPECT_NE(result.output.find("--timeout"), std::string::npos);
+}
+
+TEST_F(CLITest, ScanMissingInput_ReturnsError) {
+    auto result = runCommand("scan");
+    
+    EXPECT_EQ(result.exitCode, 1);
+    EXPECT_NE(result.output.find("Error: Missing directory, glob or plugin path"), std::string::npos);
+}
+
+TEST_F(CLITest, ScanNonExistentPath_ReturnsError) {
+    auto result = runCommand("scan /nonexistent/path/to/modules");
+    
+    EXPECT_EQ(result.exitCode, 1);
+    EXPECT_NE(result.output.find("Error: No such file or directory"), std::string::npos);
+}
+
+TEST_F(CLITest, ScanBadJobs_ReturnsError) {
+    auto result = runCommand("scan . --jobs zero");
+    
+    EXPECT_EQ(result.exitCode, 1);
+    EXPECT_NE(result.output.find("expects a positive number"), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Scan_LoadsPluginInWorker) {
+    auto result = runCommand("scan " + testPlugin);
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("\"ok\": true"), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\": \"package_manager\""), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\": \"installPlugin\""), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Scan_MetadataOnlyDirectory) {
+    std::string dir = testPlugin.substr(0, testPlugin.find_last_of('/'));
+    auto result = runCommand("scan " + dir + " --metadata-only --ndjson");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("{\"path\":"), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\":\"package_manager\""), std::string::npos);
+    // Metadata-only records never carry the interface
+    EXPECT_EQ(result.output.find("installPlugin"), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Scan_NonPluginFileFails) {
+    char notPlugin[] = "/tmp/lm_scan_not_a_plugin_XXXXXX";
+    int fd = mkstemp(notPlugin);
+    ASSERT_NE(fd, -1);
+    ASSERT_EQ(write(fd, "not a plugin\n", 13), 13);
+    close(fd);
+
+    auto result = runCommand("scan " + testPlugin + " " + notPlugin + " --metadata-only");
+    std::remove(notPlugin);
+    
+    EXPECT_EQ(result.exitCode, 1);
+    EXPECT_NE(result.output.find("\"ok\": false"), std::string::npos);
+    EXPECT_NE(result.output.find("\"ok\": true"), std::string::npos);
+}
+
+// =============================================================================
+// Serve Command
+// =============================================================================
+
+class CLIServeTest : public CLIPluginTest {
+protected:
+    // Run `lm serve` with the given request lines on stdin
+    CommandResult serve(const std::vector<std::string>& requests) {
+        char inputPath[] = "/tmp/lm_serve_input_XXXXXX";
+        int fd = mkstemp(inputPath);
+        if (fd == -1) {
+            return {-1, ""};
+        }
+        for (const auto& request : requests) {
+            std::string line = request + "\n";
+            if (write(fd, line.data(), line.size()) != static_cast<ssize_t>(line.size())) {
+                close(fd);
+                std::remove(inputPath);
+                return {-1, ""};
+            }
+        }
+        close(fd);
+        auto result = runCommand(std::string("serve < ") + inputPath);
+        std::remove(inputPath);
+        return result;
+    }
+};
+
+TEST_F(CLITest, ServeHelp_ShowsCommandHelp) {
+    auto result = runCommand("serve --help");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("Usage: lm serve"), std::string::npos);
+    EXPECT_NE(result.output.find("shutdown"), std::string::npos);
+}
+
+TEST_F(CLIServeTest, Serve_AnswersRepeatedRequests) {
+    std::string methods = "{\"id\": 1, \"command\": \"methods\", \"path\": \"" + testPlugin + "\"}";
+    std::string again = "{\"id\": 2, \"command\": \"methods\", \"path\": \"" + testPlugin + "\"}";
+    std::string metadata = "{\"id\": 3, \"command\": \"metadata\", \"path\": \"" + testPlugin + "\"}";
+    auto result = serve({methods, again, metadata});
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("{\"id\":1,\"ok\":true,\"result\":["), std::string::npos);
+    EXPECT_NE(result.output.find("{\"id\":2,\"ok\":true,\"result\":["), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\":\"installPlugin\""), std::string::npos);
+    EXPECT_NE(result.output.find("{\"id\":3,\"ok\":true,\"result\":{"), std::string::npos);
+    EXPECT_NE(result.output.find("\"name\":\"package_manager\""), std::string::npos);
+}
+
+TEST_F(CLIServeTest, Serve_ReportsErrorsAndContinues) {
+    auto result = serve({
+        "not json",
+        "{\"id\": \"a\", \"command\": \"bogus\", \"path\": \"x\"}",
+        "{\"id\": \"b\", \"command\": \"methods\", \"path\": \"/nonexistent/plugin.so\"}",
+        "{\"id\": \"c\", \"command\": \"shutdown\"}",
+        "{\"id\": \"d\", \"command\": \"metadata\", \"path\": \"" + testPlugin + "\"}",
+    });
+    
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("{\"id\":null,\"ok\":false,\"error\":\"Invalid request"), std::string::npos);
+    EXPECT_NE(result.output.find("\"id\":\"a\",\"ok\":false,\"error\":\"Unknown command: bogus\""), std::string::npos);
+    EXPECT_NE(result.output.find("\"id\":\"b\",\"ok\":false,\"error\":\"Plugin file not found"), std::string::npos);
+    EXPECT_NE(result.output.find("{\"id\":\"c\",\"ok\":true,\"result\":true}"), std::string::npos);
+    // Nothing is answered after shutdown
+    EXPECT_EQ(result.output.find("\"id\":\"d\""), std::string::npos);
+}
+
+// =============================================================================
+// NDJSON Output
+// =============================================================================
+
+namespace {
+std::vector<std::string> outputLines(const std::string& output) {
+    std::vector<std::string> lines;
+    size_t start = 0;
+    while (start < output.size()) {
+        size_t end = output.find('\n', start);
+        if (end == std::string::npos) end = output.size();
+        if (end > start) lines.push_back(output.substr(start, end - start));
+        start = end + 1;
+    }
+    return lines;
+}
+} // namespace
+
+TEST_F(CLIPluginTest, Methods_NdjsonOneRecordPerMethod) {
+    auto result = runCommand("methods " + testPlugin + " --ndjson");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    auto lines = outputLines(result.output);
+    ASSERT_EQ(lines.size(), 4u);
+    for (const auto& line : lines) {
+        EXPECT_EQ(line.front(), '{');
+        EXPECT_EQ(line.back(), '}');
+    }
+    EXPECT_NE(result.output.find("\"name\":\"installPlugin\""), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Metadata_NdjsonSingleRecord) {
+    auto result = runCommand("metadata " + testPlugin + " --ndjson");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    auto lines = outputLines(result.output);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_NE(lines[0].find("\"name\":\"package_manager\""), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Info_NdjsonSingleRecord) {
+    auto result = runCommand(testPlugin + " --ndjson");
+    
+    EXPECT_EQ(result.exitCode, 0);
+    auto lines = outputLines(result.output);
+    ASSERT_EQ(lines.size(), 1u);
+    EXPECT_EQ(lines[0].rfind("{\"events\":[", 0), 0u);
+    EXPECT_NE(lines[0].find("\"metadata\":{"), std::string::npos);
+    EXPECT_NE(lines[0].find("\"name\":\"installPlugin\""), std::string::npos);
+}
+
+// =============================================================================
+// Export-Interface Command
+// =============================================================================
+
+TEST_F(CLITest, ExportInterfaceMissingPlugin_ReturnsError) {
+    auto result = runCommand("export-interface");
+    
+    EXPECT_EQ(result.exitCode, 1);
+    EXPECT_NE(result.output.find("Error: Missing plugin path"), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, ExportInterface_SidecarAnswersWithoutLoading) {
+    char dir[] = "/tmp/lm_export_interface_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    const std::string copy = std::string(dir) + "/package_manager_plugin." +
+                             testPlugin.substr(testPlugin.find_last_of('.') + 1);
+    ASSERT_EQ(std::system(("cp " + testPlugin + " " + copy).c_str()), 0);
+
+    auto exported = runCommand("export-interface " + copy + " --json");
+    EXPECT_EQ(exported.exitCode, 0);
+    EXPECT_NE(exported.output.find("\"methods\": 4"), std::string::npos);
+
+    const std::string sidecar = std::string(dir) + "/package_manager_plugin.interface.json";
+    EXPECT_EQ(access(sidecar.c_str(), R_OK), 0);
+
+    // Served from the sidecar, the output is the same as from the plugin
+    auto fromPlugin = runCommand("methods " + testPlugin + " --json");
+    auto fromSidecar = runCommand("methods " + copy + " --json");
+    EXPECT_EQ(fromSidecar.exitCode, 0);
+    EXPECT_EQ(fromSidecar.output, fromPlugin.output);
+
+    // A changed binary invalidates the sidecar; lm falls back to loading
+    ASSERT_EQ(std::system(("printf x >> " + copy).c_str()), 0);
+    auto stale = runCommand("methods " + copy + " --json");
+    EXPECT_EQ(stale.output.find("\"name\": \"installPlugin\"") != std::string::npos,
+              stale.exitCode == 0);
+
+    std::system((std::string("rm -rf ") + dir).c_str());
+}
+
+// =============================================================================
+// --timings
+// =============================================================================
+
+TEST_F(CLITest, Help_ListsTimingsOption) {
+    auto result = runCommand("--help");
+
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("--timings"), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Methods_TimingsBreakdown) {
+    auto result = runCommand("methods " + testPlugin + " --timings");
+
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("Timings:"), std::string::npos);
+    EXPECT_NE(result.output.find("plugin constructor"), std::string::npos);
+    EXPECT_NE(result.output.find("total load"), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Info_JsonTimingsObject) {
+    auto result = runCommand(testPlugin + " --json --timings");
+
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("\"timings\": {"), std::string::npos);
+    EXPECT_NE(result.output.find("\"instanceNs\":"), std::string::npos);
+    EXPECT_EQ(result.output.find("Timings:"), std::string::npos);
+}
+
+TEST_F(CLIPluginTest, Info_JsonMemoryObject) {
+    auto result = runCommand(testPlugin + " --json --memory");
+
+    EXPECT_EQ(result.exitCode, 0);
+    EXPECT_NE(result.output.find("\"memory\": {"), std::string::npos);
+    EXPECT_NE(result.output.find("\"mappedBytes\":"), std::string::npos);
+    EXPECT_NE(result.output.find("\"interfaceBytes\":"), std::string::npos);
+}
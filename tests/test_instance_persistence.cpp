@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 #include "instance_persistence.h"
 #include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QRegularExpression>
 #include <QTemporaryDir>
 
@@ -42,18 +46,64 @@ TEST_F(InstancePersistenceTest, ReuseOrCreate_ReusesExistingInstance) {
     EXPECT_EQ(first.persistencePath.toStdString(), second.persistencePath.toStdString());
 }
 
-TEST_F(InstancePersistenceTest, ReuseOrCreate_ReusesFirstWhenMultipleExist) {
+TEST_F(InstancePersistenceTest, ReuseOrCreate_ReusesMostRecentWhenMultipleExist) {
     // Create two instances via AlwaysCreate
     auto first = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
     auto second = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
     ASSERT_NE(first.instanceId.toStdString(), second.instanceId.toStdString());
 
-    // ReuseOrCreate should pick the first one alphabetically
+    // ReuseOrCreate should pick the one used last, whatever the IDs sort as
     auto resolved = resolveInstance(basePath(), "my_module", ResolveMode::ReuseOrCreate);
-    QDir moduleDir(basePath() + "/my_module");
-    QStringList entries = moduleDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
-    ASSERT_FALSE(entries.isEmpty());
-    EXPECT_EQ(resolved.instanceId.toStdString(), entries.first().toStdString());
+    EXPECT_EQ(resolved.instanceId.toStdString(), second.instanceId.toStdString());
+
+    resolveInstance(basePath(), "my_module", ResolveMode::UseExplicit, first.instanceId);
+    resolved = resolveInstance(basePath(), "my_module", ResolveMode::ReuseOrCreate);
+    EXPECT_EQ(resolved.instanceId.toStdString(), first.instanceId.toStdString());
+}
+
+TEST_F(InstancePersistenceTest, ReuseOrCreate_WithoutRegistry_ReusesFirstByName) {
+    // Instance directories created before registries existed
+    QDir().mkpath(basePath() + "/my_module/bbb");
+    QDir().mkpath(basePath() + "/my_module/aaa");
+
+    auto resolved = resolveInstance(basePath(), "my_module", ResolveMode::ReuseOrCreate);
+    EXPECT_EQ(resolved.instanceId.toStdString(), "aaa");
+    EXPECT_TRUE(QFileInfo::exists(basePath() + "/my_module/" + RegistryFileName));
+}
+
+TEST_F(InstancePersistenceTest, ReuseOrCreate_PureReuseDoesNotRewriteRegistry) {
+    auto first = resolveInstance(basePath(), "my_module");
+    ASSERT_FALSE(first.instanceId.isEmpty());
+
+    // Mark the registry: a rewrite would drop the unknown key
+    QFile file(basePath() + "/my_module/" + RegistryFileName);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+    file.close();
+    root["marker"] = true;
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write(QJsonDocument(root).toJson());
+    file.close();
+
+    auto again = resolveInstance(basePath(), "my_module");
+    EXPECT_EQ(again.instanceId.toStdString(), first.instanceId.toStdString());
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    EXPECT_TRUE(QJsonDocument::fromJson(file.readAll()).object().value("marker").toBool());
+    file.close();
+
+    // A new instance is a change, and is written
+    resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+    EXPECT_FALSE(QJsonDocument::fromJson(file.readAll()).object().contains("marker"));
+}
+
+TEST_F(InstancePersistenceTest, ReuseOrCreate_SkipsDeletedMostRecent) {
+    auto first = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    auto second = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    ASSERT_TRUE(QDir(second.persistencePath).removeRecursively());
+
+    auto resolved = resolveInstance(basePath(), "my_module", ResolveMode::ReuseOrCreate);
+    EXPECT_EQ(resolved.instanceId.toStdString(), first.instanceId.toStdString());
 }
 
 // =============================================================================
@@ -104,6 +154,23 @@ TEST_F(InstancePersistenceTest, UseExplicit_CreatesDirectoryIfNeeded) {
     EXPECT_TRUE(QDir(expectedPath).exists());
 }
 
+TEST_F(InstancePersistenceTest, UseExplicit_ReusesExistingAndCreatesBesideIt) {
+    auto first = resolveInstance(basePath(), "my_module", ResolveMode::UseExplicit, "kept");
+    ASSERT_FALSE(first.instanceId.isEmpty());
+    QFile marker(first.persistencePath + "/state.txt");
+    ASSERT_TRUE(marker.open(QIODevice::WriteOnly));
+    marker.close();
+
+    auto again = resolveInstance(basePath(), "my_module", ResolveMode::UseExplicit, "kept");
+    EXPECT_EQ(again.persistencePath.toStdString(), first.persistencePath.toStdString());
+    EXPECT_TRUE(QFile::exists(again.persistencePath + "/state.txt"));
+
+    // A new explicit ID under the existing module directory
+    auto other = resolveInstance(basePath(), "my_module", ResolveMode::UseExplicit, "other");
+    EXPECT_EQ(other.instanceId.toStdString(), "other");
+    EXPECT_TRUE(QDir(other.persistencePath).exists());
+}
+
 TEST_F(InstancePersistenceTest, UseExplicit_FailsWithEmptyId) {
     auto info = resolveInstance(basePath(), "my_module",
                                 ResolveMode::UseExplicit, "");
@@ -272,3 +339,166 @@ TEST_F(InstancePersistenceTest, GeneratedIdIs12HexChars) {
     EXPECT_TRUE(hexPattern.match(info.instanceId).hasMatch())
         << "Instance ID should be 12 hex chars, got: " << info.instanceId.toStdString();
 }
+
+// =============================================================================
+// resolveInstances batch
+// =============================================================================
+
+TEST_F(InstancePersistenceTest, Batch_MatchesSequentialSemantics) {
+    auto existing = resolveInstance(basePath(), "module_a");
+    ASSERT_FALSE(existing.instanceId.isEmpty());
+
+    auto results = resolveInstances(basePath(), {
+        {"module_a", ResolveMode::ReuseOrCreate, QString()},
+        {"module_b", ResolveMode::ReuseOrCreate, QString()},
+        {"module_b", ResolveMode::ReuseOrCreate, QString()},
+        {"module_c", ResolveMode::UseExplicit, "fixed_id"},
+        {"module_a", ResolveMode::AlwaysCreate, QString()},
+    });
+
+    ASSERT_EQ(results.size(), 5u);
+    EXPECT_EQ(results[0].instanceId.toStdString(), existing.instanceId.toStdString());
+    // The second module_b request reuses the directory the first one created
+    EXPECT_FALSE(results[1].instanceId.isEmpty());
+    EXPECT_EQ(results[2].instanceId.toStdString(), results[1].instanceId.toStdString());
+    EXPECT_EQ(results[3].instanceId.toStdString(), "fixed_id");
+    EXPECT_NE(results[4].instanceId.toStdString(), existing.instanceId.toStdString());
+
+    for (const auto& info : results) {
+        EXPECT_TRUE(QDir(info.persistencePath).exists());
+    }
+}
+
+TEST_F(InstancePersistenceTest, Batch_ReuseSeesInstancesCreatedEarlierInBatch) {
+    auto results = resolveInstances(basePath(), {
+        {"my_module", ResolveMode::AlwaysCreate, QString()},
+        {"my_module", ResolveMode::AlwaysCreate, QString()},
+        {"my_module", ResolveMode::ReuseOrCreate, QString()},
+    });
+
+    ASSERT_EQ(results.size(), 3u);
+    QStringList entries = QDir(basePath() + "/my_module")
+        .entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+    ASSERT_EQ(entries.size(), 2);
+    EXPECT_EQ(results[2].instanceId.toStdString(), results[1].instanceId.toStdString());
+}
+
+TEST_F(InstancePersistenceTest, Batch_InvalidRequestDoesNotAffectOthers) {
+    auto results = resolveInstances(basePath(), {
+        {"../escape", ResolveMode::ReuseOrCreate, QString()},
+        {"my_module", ResolveMode::UseExplicit, QString()},
+        {"my_module", ResolveMode::ReuseOrCreate, QString()},
+    });
+
+    ASSERT_EQ(results.size(), 3u);
+    EXPECT_TRUE(results[0].instanceId.isEmpty());
+    EXPECT_TRUE(results[1].instanceId.isEmpty());
+    EXPECT_FALSE(results[2].instanceId.isEmpty());
+}
+
+TEST_F(InstancePersistenceTest, Batch_EmptyBasePath_ReturnsEmptyEntries) {
+    auto results = resolveInstances(QString(), {{"my_module", ResolveMode::ReuseOrCreate, QString()}});
+
+    ASSERT_EQ(results.size(), 1u);
+    EXPECT_TRUE(results[0].instanceId.isEmpty());
+    EXPECT_TRUE(results[0].persistencePath.isEmpty());
+}
+
+TEST_F(StdStringInstancePersistenceTest, StdString_Batch_MatchesQStringOverload) {
+    auto results = resolveInstances(basePath(), std::vector<StdInstanceRequest>{
+        {"my_module", ResolveMode::UseExplicit, "abc"},
+        {"my_module", ResolveMode::ReuseOrCreate, ""},
+    });
+
+    ASSERT_EQ(results.size(), 2u);
+    EXPECT_EQ(results[0].instanceId, "abc");
+    EXPECT_EQ(results[1].instanceId, "abc");
+}
+
+// =============================================================================
+// Registry: list, remove, prune
+// =============================================================================
+
+TEST_F(InstancePersistenceTest, ListInstances_MostRecentFirst) {
+    auto first = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    auto second = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    resolveInstance(basePath(), "my_module", ResolveMode::UseExplicit, first.instanceId);
+
+    auto records = listInstances(basePath(), "my_module");
+    ASSERT_EQ(records.size(), 2u);
+    EXPECT_EQ(records[0].instanceId.toStdString(), first.instanceId.toStdString());
+    EXPECT_EQ(records[1].instanceId.toStdString(), second.instanceId.toStdString());
+    EXPECT_GT(records[0].createdMs, 0);
+    EXPECT_GE(records[0].lastUsedMs, records[0].createdMs);
+}
+
+TEST_F(InstancePersistenceTest, ListInstances_ReconcilesWithDisk) {
+    auto kept = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    auto deleted = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    ASSERT_TRUE(QDir(deleted.persistencePath).removeRecursively());
+    ASSERT_TRUE(QDir().mkpath(basePath() + "/my_module/manual"));
+
+    auto records = listInstances(basePath(), "my_module");
+    QStringList ids;
+    for (const auto& record : records) {
+        ids.append(record.instanceId);
+    }
+    ids.sort();
+    QStringList expected{kept.instanceId, "manual"};
+    expected.sort();
+    EXPECT_EQ(ids, expected);
+}
+
+TEST_F(InstancePersistenceTest, ListInstances_UnknownModule_IsEmpty) {
+    EXPECT_TRUE(listInstances(basePath(), "missing_module").empty());
+    EXPECT_TRUE(listInstances(basePath(), "../escape").empty());
+}
+
+TEST_F(InstancePersistenceTest, RemoveInstance_DeletesDirectoryAndEntry) {
+    auto first = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    auto second = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+
+    EXPECT_TRUE(removeInstance(basePath(), "my_module", second.instanceId));
+    EXPECT_FALSE(QDir(second.persistencePath).exists());
+    EXPECT_FALSE(removeInstance(basePath(), "my_module", second.instanceId));
+    EXPECT_FALSE(removeInstance(basePath(), "my_module", "../escape"));
+
+    auto resolved = resolveInstance(basePath(), "my_module", ResolveMode::ReuseOrCreate);
+    EXPECT_EQ(resolved.instanceId.toStdString(), first.instanceId.toStdString());
+}
+
+TEST_F(InstancePersistenceTest, PruneInstances_KeepsMostRecent) {
+    auto first = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    auto second = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    auto third = resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+
+    // Everything counts as idle with a negative threshold
+    QStringList removed = pruneInstances(basePath(), "my_module", -1000, 1);
+    removed.sort();
+    QStringList expected{first.instanceId, second.instanceId};
+    expected.sort();
+    EXPECT_EQ(removed, expected);
+    EXPECT_TRUE(QDir(third.persistencePath).exists());
+    EXPECT_FALSE(QDir(first.persistencePath).exists());
+}
+
+TEST_F(InstancePersistenceTest, PruneInstances_RecentlyUsedNotIdle) {
+    resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+    resolveInstance(basePath(), "my_module", ResolveMode::AlwaysCreate);
+
+    EXPECT_TRUE(pruneInstances(basePath(), "my_module", 60 * 60 * 1000, 0).isEmpty());
+    EXPECT_EQ(listInstances(basePath(), "my_module").size(), 2u);
+}
+
+TEST_F(StdStringInstancePersistenceTest, StdString_RegistryOverloads) {
+    auto info = resolveInstance(basePath(), "my_module", ResolveMode::UseExplicit, "abc");
+    ASSERT_EQ(info.instanceId, "abc");
+
+    auto records = listInstances(basePath(), std::string("my_module"));
+    ASSERT_EQ(records.size(), 1u);
+    EXPECT_EQ(records[0].instanceId, "abc");
+
+    EXPECT_TRUE(pruneInstances(basePath(), std::string("my_module"), 60 * 60 * 1000).empty());
+    EXPECT_TRUE(removeInstance(basePath(), std::string("my_module"), std::string("abc")));
+    EXPECT_TRUE(listInstances(basePath(), std::string("my_module")).empty());
+}
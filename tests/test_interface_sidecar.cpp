@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include "interface_sidecar.h"
+#include "logos_module.h"
+#include "test_plugin_path.h"
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <string>
+
+using namespace ModuleLib;
+
+namespace {
+
+QJsonArray sampleMethods() {
+    QJsonObject method;
+    method["name"] = "ping";
+    method["signature"] = "ping()";
+    method["returnType"] = "QString";
+    method["isInvokable"] = true;
+    return QJsonArray{method};
+}
+
+// Hand-written sidecar describing the plugin file at pluginPath as it is now
+bool writeSidecarFor(const QString& pluginPath, const QJsonArray& methods) {
+    QJsonObject binary;
+    binary["sha256"] = InterfaceSidecar::checksum(pluginPath);
+    binary["size"] = QString::number(QFile(pluginPath).size());
+
+    QJsonObject root;
+    root["version"] = InterfaceSidecar::FormatVersion;
+    root["module"] = "sample";
+    root["binary"] = binary;
+    root["methods"] = methods;
+    root["events"] = QJsonArray();
+    return writeFile(InterfaceSidecar::sidecarPath(pluginPath), QJsonDocument(root).toJson());
+}
+
+} // namespace
+
+// =============================================================================
+// Paths and checksums
+// =============================================================================
+
+TEST(InterfaceSidecarTest, SidecarPath_ReplacesLibrarySuffix) {
+    EXPECT_EQ(InterfaceSidecar::sidecarPath("/modules/foo_plugin.so"),
+              QString("/modules/foo_plugin.interface.json"));
+    EXPECT_EQ(InterfaceSidecar::sidecarPath("/modules/foo_plugin.dylib"),
+              QString("/modules/foo_plugin.interface.json"));
+}
+
+TEST(InterfaceSidecarTest, Checksum_IsSha256Hex) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("abc.so");
+    ASSERT_TRUE(writeFile(path, "abc"));
+
+    EXPECT_EQ(InterfaceSidecar::checksum(path),
+              QString("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+}
+
+TEST(InterfaceSidecarTest, Checksum_MissingFile_IsEmpty) {
+    EXPECT_TRUE(InterfaceSidecar::checksum("/nonexistent/plugin.so").isEmpty());
+}
+
+// =============================================================================
+// Reading
+// =============================================================================
+
+TEST(InterfaceSidecarTest, Read_NoSidecar_ReturnsNullopt) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+
+    QString error;
+    EXPECT_FALSE(InterfaceSidecar::read(path, &error).has_value());
+    EXPECT_FALSE(error.isEmpty());
+}
+
+TEST(InterfaceSidecarTest, Read_MatchingSidecar_ReturnsInterface) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+    ASSERT_TRUE(writeSidecarFor(path, sampleMethods()));
+
+    auto sidecar = InterfaceSidecar::read(path);
+    ASSERT_TRUE(sidecar.has_value());
+    EXPECT_EQ(sidecar->moduleName(), QString("sample"));
+    EXPECT_EQ(sidecar->methods(), sampleMethods());
+    EXPECT_TRUE(sidecar->events().isEmpty());
+}
+
+TEST(InterfaceSidecarTest, Read_ChangedBinary_ReturnsNullopt) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+    ASSERT_TRUE(writeSidecarFor(path, sampleMethods()));
+    ASSERT_TRUE(InterfaceSidecar::read(path).has_value());
+
+    // Same size, different content
+    ASSERT_TRUE(writeFile(path, "BINARY"));
+    EXPECT_FALSE(InterfaceSidecar::read(path).has_value());
+}
+
+TEST(InterfaceSidecarTest, Read_CorruptSidecar_ReturnsNullopt) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+    ASSERT_TRUE(writeFile(InterfaceSidecar::sidecarPath(path), "{ not json"));
+
+    EXPECT_FALSE(InterfaceSidecar::read(path).has_value());
+}
+
+// =============================================================================
+// Lazy handles and the example plugin
+// =============================================================================
+
+TEST(InterfaceSidecarTest, LazyHandle_ServedFromSidecarWithoutLoading) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString copy = tmpDir.filePath("package_manager_plugin." + testPluginSuffix(testPlugin));
+    ASSERT_TRUE(QFile::copy(QString::fromStdString(testPlugin), copy));
+    ASSERT_TRUE(writeSidecarFor(copy, sampleMethods()));
+
+    LogosModule lazy = LogosModule::lazyFromPath(copy);
+    ASSERT_TRUE(lazy.isValid());
+    EXPECT_EQ(lazy.getMethodsAsJson(), sampleMethods());
+    EXPECT_TRUE(lazy.getEventsAsJson().isEmpty());
+    EXPECT_FALSE(lazy.isLoaded());
+}
+
+TEST(InterfaceSidecarTest, Write_RoundTripsLoadedInterface) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    // Full dlopen can fail in headless CI; only check the round trip if it works
+    LogosModule module = LogosModule::loadFromPath(testPlugin);
+    if (!module.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString copy = tmpDir.filePath("package_manager_plugin." + testPluginSuffix(testPlugin));
+    ASSERT_TRUE(QFile::copy(QString::fromStdString(testPlugin), copy));
+
+    QString error;
+    ASSERT_TRUE(InterfaceSidecar::write(module, copy, QString(), &error)) << error.toStdString();
+
+    auto sidecar = InterfaceSidecar::read(copy);
+    ASSERT_TRUE(sidecar.has_value());
+    EXPECT_EQ(sidecar->moduleName(), QString("package_manager"));
+    EXPECT_EQ(sidecar->methods(), module.getMethodsAsJson());
+    EXPECT_EQ(sidecar->events(), module.getEventsAsJson());
+}
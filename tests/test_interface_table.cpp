@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+#include "interface_table.h"
+#include "logos_module.h"
+#include <QObject>
+
+using namespace ModuleLib;
+
+namespace {
+MethodInfo makeMethod(const QString& name, const QString& signature,
+                      const std::vector<std::pair<QString, QString>>& params = {}) {
+    MethodInfo info;
+    info.name = name;
+    info.signature = signature;
+    info.returnType = "QString";
+    info.isInvokable = true;
+    for (const auto& [type, paramName] : params) {
+        info.parameters.push_back({paramName, type});
+    }
+    return info;
+}
+} // namespace
+
+// =============================================================================
+// StringPool
+// =============================================================================
+
+TEST(StringPoolTest, InternReturnsSamePointer) {
+    StringPool& pool = StringPool::global();
+    const QString* a = pool.intern(QString("QVariantList"));
+    const QString* b = pool.intern(QByteArray("QVariantList"));
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a->toStdString(), "QVariantList");
+    pool.release(a);
+    pool.release(b);
+}
+
+TEST(StringPoolTest, DistinctStringsGetDistinctEntries) {
+    StringPool pool;
+    const QString* a = pool.intern(QString("int"));
+    const QString* b = pool.intern(QString("bool"));
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.size(), 2u);
+    pool.intern(QString("int"));
+    EXPECT_EQ(pool.size(), 2u);
+}
+
+TEST(StringPoolTest, ReleaseDropsLastReference) {
+    StringPool pool;
+    const QString* a = pool.intern(QString("int"));
+    pool.intern(QString("int"));
+    pool.release(a);
+    EXPECT_EQ(pool.size(), 1u);
+    pool.release(a);
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+// =============================================================================
+// InterfaceTable
+// =============================================================================
+
+TEST(InterfaceTableTest, AppendAndView) {
+    InterfaceTable table;
+    table.append(makeMethod("greet", "greet(QString,int)", {{"QString", "who"}, {"int", "times"}}));
+    table.append(makeMethod("ping", "ping()"));
+    table.finalize();
+
+    ASSERT_EQ(table.methodCount(), 2u);
+    InterfaceTable::MethodView greet = table.method(0);
+    EXPECT_EQ(greet.name().toStdString(), "greet");
+    EXPECT_EQ(greet.signature().toStdString(), "greet(QString,int)");
+    ASSERT_EQ(greet.parameterCount(), 2u);
+    EXPECT_EQ(greet.parameterType(0).toStdString(), "QString");
+    EXPECT_EQ(greet.parameterName(1).toStdString(), "times");
+    EXPECT_EQ(table.method(1).parameterCount(), 0u);
+}
+
+TEST(InterfaceTableTest, ViewRoundTripsMethodInfo) {
+    MethodInfo original = makeMethod("greet", "greet(QString)", {{"QString", "who"}});
+    original.description = "Says hello";
+    original.metaMethodIndex = 7;
+
+    InterfaceTable table;
+    table.append(original);
+    table.finalize();
+
+    MethodInfo copy = table.method(0).toMethodInfo();
+    EXPECT_EQ(copy.toJson(), original.toJson());
+    EXPECT_EQ(copy.metaMethodIndex, 7);
+    EXPECT_EQ(table.method(0).toJson(), original.toJson());
+}
+
+TEST(InterfaceTableTest, SharesTypeNamesAcrossTables) {
+    InterfaceTable a;
+    InterfaceTable b;
+    a.append(makeMethod("one", "one(QString)", {{"QString", "x"}}));
+    b.append(makeMethod("two", "two(QString)", {{"QString", "y"}}));
+    a.finalize();
+    b.finalize();
+
+    EXPECT_EQ(&a.method(0).parameterType(0), &b.method(0).parameterType(0));
+    EXPECT_EQ(&a.method(0).returnType(), &b.method(0).returnType());
+}
+
+TEST(InterfaceTableTest, DestroyedTableReleasesItsStrings) {
+    const std::size_t before = StringPool::global().size();
+    for (int reload = 0; reload < 3; ++reload) {
+        InterfaceTable table;
+        table.append(makeMethod("reloadOnly", "reloadOnly(ReloadOnlyType)", {{"ReloadOnlyType", "value"}}));
+        table.finalize();
+        EXPECT_GT(StringPool::global().size(), before);
+    }
+    EXPECT_EQ(StringPool::global().size(), before);
+}
+
+TEST(InterfaceTableTest, LookupByNameAndSignature) {
+    InterfaceTable table;
+    table.append(makeMethod("call", "call(QString)", {{"QString", "a"}}));
+    table.append(makeMethod("call", "call(QString,int)", {{"QString", "a"}, {"int", "b"}}));
+    table.finalize();
+
+    // First declared overload wins by name
+    ASSERT_TRUE(table.indexOfName("call").has_value());
+    EXPECT_EQ(*table.indexOfName("call"), 0u);
+
+    ASSERT_TRUE(table.indexOfSignature("call(QString,int)").has_value());
+    EXPECT_EQ(*table.indexOfSignature("call(QString,int)"), 1u);
+    ASSERT_TRUE(table.indexOfSignature("call(const QString&, int)").has_value());
+    EXPECT_EQ(*table.indexOfSignature("call(const QString&, int)"), 1u);
+
+    EXPECT_FALSE(table.indexOfName("missing").has_value());
+    EXPECT_FALSE(table.indexOfSignature("call(bool)").has_value());
+}
+
+TEST(InterfaceTableTest, OwnMethodOffsetSplitsInherited) {
+    InterfaceTable table;
+    table.append(makeMethod("inherited", "inherited()"));
+    table.markOwnMethodsStart();
+    table.append(makeMethod("own", "own()"));
+    table.finalize();
+
+    EXPECT_EQ(table.ownMethodOffset(), 1u);
+    auto own = table.toMethodInfos(true);
+    ASSERT_EQ(own.size(), 1u);
+    EXPECT_EQ(own[0].name.toStdString(), "own");
+    EXPECT_EQ(table.toMethodInfos(false).size(), 2u);
+}
+
+TEST(InterfaceTableTest, ModuleTableMatchesGetMethods) {
+    QObject object;
+    LogosModule module = LogosModule::wrapExisting(&object);
+    const InterfaceTable& table = module.interfaceTable();
+
+    auto methods = module.getMethods(false);
+    ASSERT_EQ(table.methodCount(), methods.size());
+    for (size_t i = 0; i < methods.size(); ++i) {
+        EXPECT_EQ(table.method(i).toJson(), methods[i].toJson());
+    }
+
+    LogosModule empty;
+    EXPECT_EQ(empty.interfaceTable().methodCount(), 0u);
+}
@@ -4,6 +4,7 @@
 #include <QCoreApplication>
 #include <QJsonDocument>
 #include <QJsonObject>
+#include <QMetaMethod>
 
 using namespace ModuleLib;
 
@@ -130,6 +131,37 @@ public:
     Q_INVOKABLE QString legacyMethod() { return "legacy"; }
 };
 
+// A new-API plugin that counts provider creations and destructions, to
+// verify LogosModule builds the provider (and its interface) once per handle
+class CountingNewApiPlugin : public QObject, public LogosProviderPlugin {
+    Q_OBJECT
+    Q_INTERFACES(LogosProviderPlugin)
+public:
+    class CountingProviderObject : public MockProviderObject {
+    public:
+        explicit CountingProviderObject(int* destroyed) : m_destroyed(destroyed) {}
+        ~CountingProviderObject() override { ++*m_destroyed; }
+        QJsonArray getMethods() override {
+            ++interfaceCalls;
+            return MockProviderObject::getMethods();
+        }
+        static inline int interfaceCalls = 0;
+    private:
+        int* m_destroyed;
+    };
+
+    explicit CountingNewApiPlugin(QObject* parent = nullptr) : QObject(parent) {
+        CountingProviderObject::interfaceCalls = 0;
+    }
+    LogosProviderObject* createProviderObject() override {
+        ++created;
+        return new CountingProviderObject(&destroyed);
+    }
+
+    int created = 0;
+    int destroyed = 0;
+};
+
 #include "test_introspection.moc"
 
 // ---------------------------------------------------------------------------
@@ -583,3 +615,341 @@ TEST(IntrospectionStdStringTest, HasMethod_StdString_ProviderPlugin) {
     EXPECT_TRUE(module.hasMethod(std::string("noArgMethod")));
     EXPECT_FALSE(module.hasMethod(std::string("nonExistent")));
 }
+
+// ---------------------------------------------------------------------------
+// Instance interface caching
+// ---------------------------------------------------------------------------
+
+TEST(InterfaceCacheTest, ProviderCreatedOncePerHandle) {
+    CountingNewApiPlugin plugin;
+    {
+        LogosModule module = LogosModule::wrapExisting(&plugin);
+
+        EXPECT_EQ(module.getMethods().size(), 3u);
+        EXPECT_EQ(module.getMethodsAsJson().size(), 3);
+        EXPECT_EQ(module.getEventsAsJson().size(), 2);
+        EXPECT_TRUE(module.hasMethod(QString("providerMethod")));
+        EXPECT_FALSE(module.hasMethod(QString("providerEvent")));
+        EXPECT_EQ(module.getMethodsAsJson().size(), 3);
+
+        EXPECT_EQ(plugin.created, 1);
+        EXPECT_EQ(CountingNewApiPlugin::CountingProviderObject::interfaceCalls, 1);
+        EXPECT_EQ(plugin.destroyed, 0);
+    }
+    // The cached provider is owned by the handle and deleted with it
+    EXPECT_EQ(plugin.destroyed, 1);
+}
+
+TEST(InterfaceCacheTest, MatchesStaticApi) {
+    CountingNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    EXPECT_EQ(module.getMethodsAsJson(), LogosModule::getMethodsAsJson(&plugin));
+    EXPECT_EQ(module.getEventsAsJson(), LogosModule::getEventsAsJson(&plugin));
+
+    auto cached = module.getMethods();
+    auto uncached = LogosModule::getMethods(&plugin);
+    ASSERT_EQ(cached.size(), uncached.size());
+    for (size_t i = 0; i < cached.size(); ++i) {
+        EXPECT_EQ(cached[i].toJson(), uncached[i].toJson());
+    }
+}
+
+TEST(InterfaceCacheTest, MoveTransfersCache) {
+    CountingNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+    EXPECT_EQ(module.getEventsAsJson().size(), 2);
+
+    LogosModule moved = std::move(module);
+    EXPECT_EQ(moved.getMethodsAsJson().size(), 3);
+    EXPECT_EQ(plugin.created, 1);
+}
+
+TEST(InterfaceCacheTest, ReleaseDropsCache) {
+    CountingNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+    EXPECT_EQ(module.getMethods().size(), 3u);
+
+    EXPECT_EQ(module.release(), &plugin);
+    EXPECT_EQ(plugin.destroyed, 1);
+    EXPECT_TRUE(module.getMethods().empty());
+    EXPECT_TRUE(module.getEventsAsJson().isEmpty());
+}
+
+TEST(InterfaceCacheTest, LegacyPluginBaseClassToggle) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    auto own = module.getMethods(true);
+    auto all = module.getMethods(false);
+    EXPECT_GT(all.size(), own.size());
+    EXPECT_EQ(own.size(), LogosModule::getMethods(&plugin, true).size());
+    EXPECT_EQ(all.size(), LogosModule::getMethods(&plugin, false).size());
+    EXPECT_TRUE(module.hasMethod(QString("deleteLater")));
+    EXPECT_TRUE(module.getEventsAsJson().isEmpty());
+}
+
+// ---------------------------------------------------------------------------
+// findMethod() lookup index
+// ---------------------------------------------------------------------------
+
+TEST(FindMethodTest, LegacyByName) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    auto method = module.findMethod(QString("methodWithMultipleParams"));
+    ASSERT_TRUE(method.has_value());
+    EXPECT_EQ(method->signature.toStdString(), "methodWithMultipleParams(QString,int,bool)");
+    EXPECT_EQ(method->parameters.size(), 3u);
+
+    // The meta-method index dispatches to the same method
+    ASSERT_GE(method->metaMethodIndex, 0);
+    QMetaMethod meta = plugin.metaObject()->method(method->metaMethodIndex);
+    EXPECT_EQ(QString::fromUtf8(meta.methodSignature()), method->signature);
+}
+
+TEST(FindMethodTest, LegacyBySignature) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    auto exact = module.findMethod(QString("testMethod(int)"));
+    ASSERT_TRUE(exact.has_value());
+    EXPECT_EQ(exact->name.toStdString(), "testMethod");
+
+    // Non-normalized signatures are accepted
+    auto spaced = module.findMethod(QString("slotWithReturn( int )"));
+    ASSERT_TRUE(spaced.has_value());
+    EXPECT_EQ(spaced->name.toStdString(), "slotWithReturn");
+
+    EXPECT_FALSE(module.findMethod(QString("testMethod(QString)")).has_value());
+}
+
+TEST(FindMethodTest, LegacyIncludesBaseClass) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    auto method = module.findMethod(std::string("deleteLater"));
+    ASSERT_TRUE(method.has_value());
+    EXPECT_LT(method->metaMethodIndex, plugin.metaObject()->methodOffset());
+}
+
+TEST(FindMethodTest, ProviderMethods) {
+    MockNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    auto method = module.findMethod(QString("multiParam"));
+    ASSERT_TRUE(method.has_value());
+    EXPECT_EQ(method->returnType.toStdString(), "void");
+    EXPECT_EQ(method->metaMethodIndex, -1);
+
+    EXPECT_TRUE(module.findMethod(QString("providerMethod(QString)")).has_value());
+
+    // Events are not methods
+    EXPECT_FALSE(module.findMethod(QString("providerEvent")).has_value());
+    EXPECT_FALSE(module.hasMethod(QString("providerEvent")));
+}
+
+TEST(FindMethodTest, NotFound) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    EXPECT_FALSE(module.findMethod(QString("nonExistent")).has_value());
+    EXPECT_FALSE(module.findMethod(QString("")).has_value());
+
+    LogosModule empty;
+    EXPECT_FALSE(empty.findMethod(QString("testMethod")).has_value());
+}
+
+TEST(FindMethodTest, StaticHasMethodMatchesInstance) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    for (const char* name : {"testMethod", "slotMethod", "deleteLater", "destroyed", "nope"}) {
+        EXPECT_EQ(LogosModule::hasMethod(&plugin, QString(name)),
+                  module.hasMethod(QString(name))) << name;
+    }
+
+    MockNewApiPlugin provider;
+    EXPECT_TRUE(LogosModule::hasMethod(&provider, "providerMethod"));
+    EXPECT_FALSE(LogosModule::hasMethod(&provider, "tickEvent"));
+}
+
+// ---------------------------------------------------------------------------
+// Shared per-class introspection cache
+// ---------------------------------------------------------------------------
+
+TEST(IntrospectionCacheTest, SameClassSharesDescription) {
+    MockPlugin a;
+    MockPlugin b;
+    LogosModule moduleA = LogosModule::wrapExisting(&a);
+    LogosModule moduleB = LogosModule::wrapExisting(&b);
+
+    auto methodsA = moduleA.getMethods(false);
+    auto methodsB = moduleB.getMethods(false);
+    ASSERT_EQ(methodsA.size(), methodsB.size());
+    for (size_t i = 0; i < methodsA.size(); ++i) {
+        EXPECT_EQ(methodsA[i].toJson(), methodsB[i].toJson());
+        EXPECT_EQ(methodsA[i].metaMethodIndex, methodsB[i].metaMethodIndex);
+        // Implicitly shared: the same QString data backs both handles
+        EXPECT_EQ(methodsA[i].signature.constData(), methodsB[i].signature.constData());
+    }
+}
+
+TEST(IntrospectionCacheTest, StaticAndInstanceAgree) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    EXPECT_EQ(LogosModule::getMethodsAsJson(&plugin, true), module.getMethodsAsJson(true));
+    EXPECT_EQ(LogosModule::getMethodsAsJson(&plugin, false), module.getMethodsAsJson(false));
+    EXPECT_EQ(LogosModule::getMethods(&plugin, true).size(), module.getMethods(true).size());
+    EXPECT_EQ(LogosModule::getMethods(&plugin, false).size(), module.getMethods(false).size());
+}
+
+TEST(IntrospectionCacheTest, ClearKeepsResultsStable) {
+    MockPlugin plugin;
+    QJsonArray before = LogosModule::getMethodsAsJson(&plugin, false);
+
+    LogosModule::clearIntrospectionCache();
+
+    EXPECT_EQ(LogosModule::getMethodsAsJson(&plugin, false), before);
+    EXPECT_TRUE(LogosModule::hasMethod(&plugin, "testMethod"));
+}
+
+TEST(IntrospectionCacheTest, DistinctClassesDoNotCollide) {
+    MockPlugin legacy;
+    MockBrokenNewApiPlugin broken;
+
+    EXPECT_TRUE(LogosModule::hasMethod(&legacy, "testMethod"));
+    EXPECT_FALSE(LogosModule::hasMethod(&legacy, "legacyMethod"));
+    EXPECT_TRUE(LogosModule::hasMethod(&broken, "legacyMethod"));
+    EXPECT_FALSE(LogosModule::hasMethod(&broken, "testMethod"));
+}
+
+// ---------------------------------------------------------------------------
+// Streamed / memoized JSON text
+// ---------------------------------------------------------------------------
+
+TEST(InterfaceJsonTextTest, LegacyMatchesQJsonDocument) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    for (bool exclude : {true, false}) {
+        const QJsonArray methods = module.getMethodsAsJson(exclude);
+        EXPECT_EQ(module.methodsJsonText(JsonFormat::Indented, exclude),
+                  QJsonDocument(methods).toJson(QJsonDocument::Indented).toStdString());
+        EXPECT_EQ(module.methodsJsonText(JsonFormat::Compact, exclude),
+                  QJsonDocument(methods).toJson(QJsonDocument::Compact).toStdString());
+    }
+    EXPECT_EQ(module.eventsJsonText(), "[\n]\n");
+}
+
+TEST(InterfaceJsonTextTest, ProviderMatchesQJsonDocument) {
+    MockNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    EXPECT_EQ(module.methodsJsonText(),
+              QJsonDocument(module.getMethodsAsJson()).toJson(QJsonDocument::Indented).toStdString());
+    EXPECT_EQ(module.eventsJsonText(JsonFormat::Compact),
+              QJsonDocument(module.getEventsAsJson()).toJson(QJsonDocument::Compact).toStdString());
+}
+
+TEST(InterfaceJsonTextTest, TextIsMemoized) {
+    CountingNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    const std::string& first = module.methodsJsonText();
+    const std::string& second = module.methodsJsonText();
+    EXPECT_EQ(&first, &second);
+    EXPECT_EQ(CountingNewApiPlugin::CountingProviderObject::interfaceCalls, 1);
+}
+
+TEST(InterfaceJsonTextTest, WriterEmbedsInterface) {
+    MockNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    std::string text;
+    JsonWriter writer(text);
+    writer.beginObject();
+    writer.key("events");
+    module.writeEventsJson(writer);
+    writer.key("methods");
+    module.writeMethodsJson(writer);
+    writer.endObject();
+
+    QJsonObject expected;
+    expected["events"] = module.getEventsAsJson();
+    expected["methods"] = module.getMethodsAsJson();
+    EXPECT_EQ(text, QJsonDocument(expected).toJson(QJsonDocument::Indented).toStdString());
+}
+
+// ---------------------------------------------------------------------------
+// LoadStats
+// ---------------------------------------------------------------------------
+
+TEST(LoadStatsTest, WrappedHandle_HasNoLoadPhases) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    const LoadStats& stats = module.loadStats();
+    EXPECT_EQ(stats.metadataReadNs, -1);
+    EXPECT_EQ(stats.libraryLoadNs, -1);
+    EXPECT_EQ(stats.instanceNs, -1);
+    EXPECT_EQ(stats.interfaceNs, -1);
+    EXPECT_EQ(stats.loadNs(), 0);
+    EXPECT_TRUE(stats.toJson().contains("loadNs"));
+    EXPECT_FALSE(stats.toJson().contains("instanceNs"));
+}
+
+TEST(LoadStatsTest, LegacyIntrospection_RecordsInterfacePhases) {
+    MockPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    const std::size_t own = module.getMethods().size();
+    EXPECT_GE(module.loadStats().interfaceNs, 0);
+    EXPECT_EQ(module.loadStats().providerCreateNs, -1);
+    EXPECT_EQ(module.loadStats().methodCount, static_cast<int>(own));
+    EXPECT_EQ(module.loadStats().eventCount, 0);
+    EXPECT_EQ(module.loadStats().methodsJsonNs, -1);
+
+    module.getMethodsAsJson();
+    EXPECT_GE(module.loadStats().methodsJsonNs, 0);
+}
+
+TEST(LoadStatsTest, ProviderIntrospection_RecordsProviderCreation) {
+    CountingNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+
+    module.methodsJsonText();
+    const LoadStats& stats = module.loadStats();
+    EXPECT_GE(stats.providerCreateNs, 0);
+    EXPECT_GE(stats.interfaceNs, 0);
+    EXPECT_GE(stats.methodsJsonNs, 0);
+    EXPECT_EQ(stats.methodCount, 3);
+    EXPECT_EQ(stats.eventCount, 2);
+    EXPECT_EQ(stats.toJson()["eventCount"].toInt(), 2);
+}
+
+TEST(LoadStatsTest, MemoryStats_CountsCachedInterface) {
+    CountingNewApiPlugin plugin;
+    LogosModule module = LogosModule::wrapExisting(&plugin);
+    EXPECT_EQ(module.memoryStats().interfaceBytes, 0);
+
+    module.getMethodsAsJson();
+    const qint64 described = module.memoryStats().interfaceBytes;
+    EXPECT_GT(described, 0);
+
+    // Memoized JSON text is held by the interface too
+    module.methodsJsonText();
+    EXPECT_GT(module.memoryStats().interfaceBytes, described);
+    EXPECT_EQ(module.memoryStats().sharedInterfaceBytes, 0);
+}
+
+TEST(LoadStatsTest, MemoryStats_ReportsSharedLegacyDescriptionSeparately) {
+    QObject object;
+    LogosModule module = LogosModule::wrapExisting(&object);
+    module.getMethods();
+
+    const MemoryStats described = module.memoryStats();
+    EXPECT_EQ(described.interfaceBytes, 0);
+    EXPECT_GT(described.sharedInterfaceBytes, 0);
+}
@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+#include "isolated_introspection.h"
+#include "file_identity.h"
+#include "logos_module.h"
+#include "metadata_cache.h"
+#include "test_plugin_path.h"
+#include <QFile>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <dlfcn.h>
+#endif
+
+using namespace ModuleLib;
+
+namespace {
+
+IsolatedInterface sampleInterface() {
+    QJsonObject method;
+    method["name"] = "ping";
+    method["signature"] = "ping()";
+    method["returnType"] = "QString";
+    method["isInvokable"] = true;
+    QJsonObject event;
+    event["name"] = "ponged";
+    event["type"] = "event";
+    return IsolatedInterface{QJsonArray{method}, QJsonArray{event}};
+}
+
+// Whether the library at path is mapped into this process; loaded is
+// reported as false where this cannot be checked
+bool isLoadedInProcess(const QString& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    void* handle = dlopen(QFile::encodeName(path).constData(), RTLD_LAZY | RTLD_NOLOAD);
+    if (handle) {
+        dlclose(handle);
+        return true;
+    }
+#else
+    Q_UNUSED(path);
+#endif
+    return false;
+}
+
+// Runs lm as the helper: $LOGOS_MODULE_HELPER if set, else the one built with the tests
+class IsolatedHelperTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (qEnvironmentVariableIsEmpty(IsolatedIntrospection::HelperProgramVariable)
+            && QFile::exists(QStringLiteral(LOGOS_TEST_LM_BINARY))) {
+            IsolatedIntrospection::setHelperProgram(QStringLiteral(LOGOS_TEST_LM_BINARY));
+        }
+        if (!IsolatedIntrospection::isSupported()) {
+            GTEST_SKIP() << "No lm helper found. Set LOGOS_MODULE_HELPER.";
+        }
+    }
+
+    void TearDown() override {
+        IsolatedIntrospection::setHelperProgram(QString());
+    }
+
+    // A copy of the example plugin under a name this process has never
+    // loaded, or an empty string (after skipping) if there is none
+    QString freshPluginCopy() {
+        const std::string testPlugin = findTestPlugin();
+        if (testPlugin.empty() || !m_tmpDir.isValid()) {
+            return QString();
+        }
+        const QString copy = m_tmpDir.filePath("isolated_plugin." + testPluginSuffix(testPlugin));
+        if (!QFile::copy(QString::fromStdString(testPlugin), copy)) {
+            return QString();
+        }
+        return copy;
+    }
+
+private:
+    QTemporaryDir m_tmpDir;
+};
+
+} // namespace
+
+// =============================================================================
+// Encoding
+// =============================================================================
+
+TEST(IsolatedIntrospectionTest, Encode_RoundTrips) {
+    const IsolatedInterface original = sampleInterface();
+    const QByteArray data = IsolatedIntrospection::encode(original);
+
+    auto decoded = IsolatedIntrospection::decode(data);
+    ASSERT_TRUE(decoded.has_value());
+    EXPECT_EQ(decoded->methods, original.methods);
+    EXPECT_EQ(decoded->events, original.events);
+}
+
+TEST(IsolatedIntrospectionTest, Decode_Garbage_ReturnsNullopt) {
+    EXPECT_FALSE(IsolatedIntrospection::decode(QByteArray()).has_value());
+    EXPECT_FALSE(IsolatedIntrospection::decode("not cbor").has_value());
+}
+
+// =============================================================================
+// Cache entries
+// =============================================================================
+
+TEST(IsolatedIntrospectionTest, Cache_ServesOnlyUnchangedFile) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+    const auto identity = FileIdentity::of(path.toStdString());
+    ASSERT_TRUE(identity.has_value());
+
+    MetadataCache cache;
+    const QByteArray data = IsolatedIntrospection::encode(sampleInterface());
+    cache.storeInterfaceData(path, *identity, data);
+    auto stored = cache.interfaceData(path);
+    ASSERT_TRUE(stored.has_value());
+    EXPECT_EQ(*stored, data);
+
+    ASSERT_TRUE(writeFile(path, "rebuilt binary"));
+    EXPECT_FALSE(cache.interfaceData(path).has_value());
+
+    // An identity that no longer matches the file is not stored
+    cache.storeInterfaceData(path, *identity, data);
+    EXPECT_FALSE(cache.interfaceData(path).has_value());
+}
+
+// =============================================================================
+// Helper process
+// =============================================================================
+
+TEST(IsolatedIntrospectionTest, MissingFile_ReturnsNullopt) {
+    QString error;
+    EXPECT_FALSE(IsolatedIntrospection::introspect("/nonexistent/plugin.so",
+                                                   IsolatedIntrospection::DefaultTimeoutMs,
+                                                   &error).has_value());
+    EXPECT_FALSE(error.isEmpty());
+}
+
+TEST(IsolatedIntrospectionTest, SetHelperProgram_OverridesLookup) {
+    IsolatedIntrospection::setHelperProgram(QStringLiteral("/opt/tools/lm"));
+    EXPECT_EQ(IsolatedIntrospection::helperProgram(), QString("/opt/tools/lm"));
+    EXPECT_TRUE(IsolatedIntrospection::isSupported());
+    IsolatedIntrospection::setHelperProgram(QString());
+    EXPECT_NE(IsolatedIntrospection::helperProgram(), QString("/opt/tools/lm"));
+}
+
+TEST(IsolatedIntrospectionTest, MissingHelperProgram_FailsWithoutLoading) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+
+    IsolatedIntrospection::setHelperProgram(tmpDir.filePath("no_such_helper"));
+    MetadataCache cache;
+    QString error;
+    EXPECT_FALSE(IsolatedIntrospection::introspect(path, IsolatedIntrospection::DefaultTimeoutMs,
+                                                   &error, &cache).has_value());
+    IsolatedIntrospection::setHelperProgram(QString());
+    EXPECT_FALSE(error.isEmpty());
+    EXPECT_FALSE(cache.interfaceData(path).has_value());
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(IsolatedIntrospectionTest, HelperWithoutHandshake_IsRejectedAndNotCached) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("plugin.so");
+    ASSERT_TRUE(writeFile(path, "binary"));
+
+    // Well-formed reply, but not from a helper that speaks the protocol
+    const QString helper = tmpDir.filePath("lm");
+    ASSERT_TRUE(writeFile(helper, "#!/bin/sh\necho '{\"methods\":[],\"events\":[]}'\n"));
+    ASSERT_TRUE(QFile::setPermissions(helper, QFile::permissions(helper) | QFileDevice::ExeOwner));
+
+    IsolatedIntrospection::setHelperProgram(helper);
+    MetadataCache cache;
+    QString error;
+    EXPECT_FALSE(IsolatedIntrospection::introspect(path, IsolatedIntrospection::DefaultTimeoutMs,
+                                                   &error, &cache).has_value());
+    IsolatedIntrospection::setHelperProgram(QString());
+    EXPECT_TRUE(error.contains(QStringLiteral("helperProtocol"))) << error.toStdString();
+    EXPECT_FALSE(cache.interfaceData(path).has_value());
+}
+#endif
+
+TEST_F(IsolatedHelperTest, UnloadableFile_FailsInHelper) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = tmpDir.filePath("broken_plugin.so");
+    ASSERT_TRUE(writeFile(path, "not a shared object"));
+
+    MetadataCache cache;
+    QString error;
+    EXPECT_FALSE(IsolatedIntrospection::introspect(path, IsolatedIntrospection::DefaultTimeoutMs,
+                                                   &error, &cache).has_value());
+    EXPECT_FALSE(error.isEmpty());
+    EXPECT_FALSE(cache.interfaceData(path).has_value());
+}
+
+TEST_F(IsolatedHelperTest, RealPlugin_NeverLoadedInProcessAndIsCached) {
+    const QString path = freshPluginCopy();
+    if (path.isEmpty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    MetadataCache cache;
+    QString error;
+    auto result = IsolatedIntrospection::introspect(path, IsolatedIntrospection::DefaultTimeoutMs,
+                                                    &error, &cache);
+    ASSERT_TRUE(result.has_value()) << error.toStdString();
+    EXPECT_FALSE(result->methods.isEmpty());
+    EXPECT_TRUE(cache.interfaceData(path).has_value());
+    EXPECT_FALSE(isLoadedInProcess(path));
+
+    // Only now load it here, to compare with what the helper reported
+    LogosModule module = LogosModule::loadFromPath(path);
+    if (!module.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+    EXPECT_EQ(result->methods, module.getMethodsAsJson());
+    EXPECT_EQ(result->events, module.getEventsAsJson());
+}
+
+TEST_F(IsolatedHelperTest, IsolatedHandle_IntrospectionNeverLoadsInProcess) {
+    const QString path = freshPluginCopy();
+    if (path.isEmpty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    LogosModule isolated = LogosModule::isolatedFromPath(path);
+    ASSERT_TRUE(isolated.isValid());
+    EXPECT_EQ(isolated.metadata().name, QString("package_manager"));
+
+    const QJsonArray methods = isolated.getMethodsAsJson();
+    ASSERT_TRUE(isolated.isValid()) << isolated.errorString().toStdString();
+    ASSERT_FALSE(methods.isEmpty());
+    const QString firstName = methods.first().toObject().value("name").toString();
+
+    EXPECT_EQ(isolated.getMethodsAsJson(/*excludeBaseClass=*/false), methods);
+    EXPECT_EQ(isolated.getMethods().size(), static_cast<std::size_t>(methods.size()));
+    EXPECT_TRUE(isolated.hasMethod(firstName));
+    EXPECT_TRUE(isolated.findMethod(firstName).has_value());
+    EXPECT_FALSE(isolated.hasMethod(QStringLiteral("noSuchMethod")));
+    EXPECT_FALSE(isolated.eventsJsonText(JsonFormat::Compact).empty());
+
+    EXPECT_FALSE(isolated.isLoaded());
+    EXPECT_FALSE(isLoadedInProcess(path));
+}
+
+TEST_F(IsolatedHelperTest, IsolatedHandle_HelperFailureIsNotLoadedInProcess) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString path = freshPluginCopy();
+    if (path.isEmpty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    // The metadata is readable, but the helper cannot run
+    LogosModule isolated = LogosModule::isolatedFromPath(path);
+    ASSERT_TRUE(isolated.isValid());
+    IsolatedIntrospection::setHelperProgram(tmpDir.filePath("no_such_helper"));
+
+    EXPECT_TRUE(isolated.getMethods().empty());
+    EXPECT_FALSE(isolated.hasMethod(QStringLiteral("anything")));
+    EXPECT_FALSE(isolated.isValid());
+    EXPECT_FALSE(isolated.errorString().isEmpty());
+    EXPECT_EQ(isolated.instance(), nullptr);
+    EXPECT_FALSE(isLoadedInProcess(path));
+}
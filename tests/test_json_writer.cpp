@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "json_writer.h"
+#include <QJsonDocument>
+
+using namespace ModuleLib;
+
+namespace {
+std::string qtJson(const QJsonValue& value, QJsonDocument::JsonFormat format) {
+    QJsonDocument doc = value.isArray() ? QJsonDocument(value.toArray())
+                                        : QJsonDocument(value.toObject());
+    return doc.toJson(format).toStdString();
+}
+
+std::string written(const QJsonValue& value, JsonFormat format) {
+    std::string text;
+    JsonWriter writer(text, format);
+    writer.value(value);
+    return text;
+}
+
+QJsonObject sampleObject() {
+    QJsonObject nested;
+    nested["flag"] = false;
+    nested["empty"] = QJsonArray();
+    nested["none"] = QJsonObject();
+
+    QJsonObject obj;
+    obj["name"] = "module \"quoted\"\\ \n\t\x01 café";
+    obj["count"] = 42;
+    obj["ratio"] = 0.25;
+    obj["big"] = 1e300;
+    obj["negative"] = -7;
+    obj["nothing"] = QJsonValue::Null;
+    obj["nested"] = nested;
+    obj["list"] = QJsonArray{1, "two", true, QJsonArray{}, QJsonObject{{"k", "v"}}};
+    return obj;
+}
+} // namespace
+
+TEST(JsonWriterTest, IndentedMatchesQJsonDocument) {
+    const QJsonObject obj = sampleObject();
+    EXPECT_EQ(written(obj, JsonFormat::Indented), qtJson(obj, QJsonDocument::Indented));
+}
+
+TEST(JsonWriterTest, CompactMatchesQJsonDocument) {
+    const QJsonObject obj = sampleObject();
+    EXPECT_EQ(written(obj, JsonFormat::Compact), qtJson(obj, QJsonDocument::Compact));
+}
+
+TEST(JsonWriterTest, ArraysMatchQJsonDocument) {
+    const QJsonArray empty;
+    EXPECT_EQ(written(empty, JsonFormat::Indented), qtJson(empty, QJsonDocument::Indented));
+    EXPECT_EQ(written(empty, JsonFormat::Compact), qtJson(empty, QJsonDocument::Compact));
+
+    const QJsonArray array{sampleObject(), sampleObject()};
+    EXPECT_EQ(written(array, JsonFormat::Indented), qtJson(array, QJsonDocument::Indented));
+}
+
+TEST(JsonWriterTest, StreamingCallsMatchQJsonDocument) {
+    std::string text;
+    JsonWriter writer(text);
+    writer.beginObject();
+    writer.key("a").value(1);
+    writer.key("b").beginArray().value("x").value(QStringLiteral("y")).endArray();
+    writer.key("c").beginObject().endObject();
+    writer.endObject();
+
+    QJsonObject expected{{"a", 1}, {"b", QJsonArray{"x", "y"}}, {"c", QJsonObject()}};
+    EXPECT_EQ(text, qtJson(expected, QJsonDocument::Indented));
+}
+
+TEST(JsonWriterTest, AppendEscaped) {
+    std::string out;
+    JsonWriter::appendEscaped(out, "a\"b\\c\x1f");
+    EXPECT_EQ(out, "a\\\"b\\\\c\\u001f");
+}
+
+TEST(JsonWriterTest, RawValueEmbedsCompactText) {
+    std::string inner;
+    JsonWriter innerWriter(inner, JsonFormat::Compact);
+    innerWriter.value(QJsonArray{1, 2});
+
+    std::string text;
+    JsonWriter writer(text, JsonFormat::Compact);
+    writer.beginObject();
+    writer.key("a").rawValue(inner);
+    writer.key("b").rawValue("true\n");
+    writer.endObject();
+
+    EXPECT_EQ(text, "{\"a\":[1,2],\"b\":true}");
+}
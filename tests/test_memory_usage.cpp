@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include "logos_module.h"
+#include "memory_usage.h"
+#include "test_plugin_path.h"
+#include <string>
+
+using namespace ModuleLib;
+
+// =============================================================================
+// Process measurements
+// =============================================================================
+
+#if defined(__linux__) || defined(__APPLE__)
+
+TEST(MemoryUsageTest, ResidentBytes_IsPositive) {
+    EXPECT_GT(MemoryUsage::residentBytes(), 0);
+}
+
+TEST(MemoryUsageTest, SharedObjects_IncludesQtCore) {
+    const std::vector<SharedObjectInfo> objects = MemoryUsage::sharedObjects();
+    ASSERT_FALSE(objects.empty());
+
+    bool foundQtCore = false;
+    for (const SharedObjectInfo& object : objects) {
+        if (object.path.find("Qt6Core") != std::string::npos
+            || object.path.find("QtCore") != std::string::npos) {
+            foundQtCore = true;
+            EXPECT_GT(object.mappedBytes, 0u);
+        }
+    }
+    EXPECT_TRUE(foundQtCore);
+}
+
+#endif
+
+// =============================================================================
+// LogosModule::memoryStats()
+// =============================================================================
+
+TEST(ModuleMemoryTest, TrackingOffByDefault_LoadFieldsUnmeasured) {
+    ASSERT_FALSE(LogosModule::isMemoryTracking());
+    LogosModule module = LogosModule::loadFromPath(QString("/nonexistent/path/to/plugin.so"));
+
+    const MemoryStats stats = module.memoryStats();
+    EXPECT_EQ(stats.rssDeltaBytes, -1);
+    EXPECT_EQ(stats.mappedBytes, -1);
+    EXPECT_TRUE(stats.newObjects.empty());
+    EXPECT_FALSE(stats.toJson().contains("mappedBytes"));
+}
+
+TEST(ModuleMemoryTest, RealPlugin_TrackedLoad) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    LogosModule::setMemoryTracking(true);
+    LogosModule module = LogosModule::loadFromPath(testPlugin);
+    LogosModule::setMemoryTracking(false);
+    if (!module.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+
+    MemoryStats stats = module.memoryStats();
+    EXPECT_GE(stats.mappedBytes, 0);
+    EXPECT_GT(stats.metadataBytes, 0);
+    EXPECT_EQ(stats.interfaceBytes, 0);
+    EXPECT_EQ(stats.sharedInterfaceBytes, 0);
+
+    // Whatever the load mapped is accounted for in mappedBytes
+    qint64 total = 0;
+    for (const SharedObjectInfo& object : stats.newObjects) {
+        total += static_cast<qint64>(object.mappedBytes);
+    }
+    EXPECT_EQ(total, stats.mappedBytes);
+
+    // A legacy plugin's description is shared by its class's handles
+    module.getMethods();
+    EXPECT_EQ(module.memoryStats().interfaceBytes, 0);
+    EXPECT_GT(module.memoryStats().sharedInterfaceBytes, 0);
+}
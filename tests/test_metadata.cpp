@@ -1,9 +1,22 @@
 #include <gtest/gtest.h>
 #include "module_metadata.h"
 #include "logos_module.h"
+#include "interface_table.h"
+#include "native_metadata_reader.h"
+#include "test_plugin_path.h"
 #include <QJsonArray>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QPluginLoader>
+#include <QTemporaryDir>
+#include <QThread>
 #include <QString>
+#include <cstdint>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 using namespace ModuleLib;
@@ -125,6 +138,27 @@ TEST(MetadataTest, FromCustomMetadata_RawMetadataPreserved) {
     EXPECT_EQ(metadata.rawMetadata.value("anotherField").toInt(), 42);
 }
 
+TEST(MetadataTest, FromCustomMetadata_TakesSourceTextVerbatim) {
+    QJsonObject json;
+    json["name"] = "test_plugin";
+    const std::string text = R"({"name":"test_plugin"})";
+
+    auto metadata = ModuleMetadata::fromCustomMetadata(json, text);
+
+    EXPECT_EQ(metadata.name.toStdString(), "test_plugin");
+    EXPECT_EQ(metadata.rawMetadataJson, text);
+}
+
+TEST(MetadataTest, FromCustomMetadata_RawJsonIsQtCompactForm) {
+    QJsonObject json;
+    json["version"] = "1.0.0";
+    json["name"] = "test_plugin";
+
+    auto metadata = ModuleMetadata::fromCustomMetadata(json);
+
+    EXPECT_EQ(metadata.rawMetadataJson, R"({"name":"test_plugin","version":"1.0.0"})");
+}
+
 // =============================================================================
 // fromJson Tests (Qt plugin metadata format)
 // =============================================================================
@@ -287,6 +321,31 @@ TEST_F(RealPluginMetadataTest, GetModuleName_ReturnsCorrectName) {
     EXPECT_EQ(name, "package_manager");
 }
 
+TEST_F(RealPluginMetadataTest, GetModuleName_AcceptsStringView) {
+    const std::string_view path(testPlugin);
+    EXPECT_EQ(LogosModule::getModuleName(path), "package_manager");
+    EXPECT_EQ(LogosModule::getModuleName(testPlugin.c_str()), "package_manager");
+
+    // A view into a longer buffer only covers its own characters
+    const std::string padded = testPlugin + ".unused";
+    EXPECT_EQ(LogosModule::getModuleName(std::string_view(padded).substr(0, testPlugin.size())),
+              "package_manager");
+}
+
+TEST_F(RealPluginMetadataTest, GetRawMetadataJson_SameTextFromEveryPath) {
+    auto metadata = ModuleMetadata::fromPath(testPlugin);
+    ASSERT_TRUE(metadata.has_value());
+
+    const std::string raw = LogosModule::getRawMetadataJson(testPlugin);
+    EXPECT_EQ(raw, QJsonDocument(metadata->rawMetadata).toJson(QJsonDocument::Compact).toStdString());
+
+    // Full dlopen can fail in headless CI; only compare the loader's text if it works
+    LogosModule module = LogosModule::loadFromPath(testPlugin);
+    if (module.isValid()) {
+        EXPECT_EQ(module.metadata().rawMetadataJson, raw);
+    }
+}
+
 TEST_F(RealPluginMetadataTest, GetModuleDependencies_ReturnsEmptyForNoDeps) {
     std::vector<std::string> deps = LogosModule::getModuleDependencies(testPlugin);
     EXPECT_TRUE(deps.empty());
@@ -398,3 +457,614 @@ TEST_F(RealPluginMetadataTest, MetadataFromPath_StdString_ReturnsMetadata) {
     EXPECT_TRUE(result->isValid());
     EXPECT_EQ(result->name.toStdString(), "package_manager");
 }
+
+// =============================================================================
+// Typed field Tests
+// =============================================================================
+
+static_assert(ProtocolVersion::parse("1.2.3") == ProtocolVersion{1, 2, 3});
+static_assert(ProtocolVersion::parse("2").isCompatibleWith(2));
+static_assert(!ProtocolVersion::parse("").isValid());
+static_assert(std::string_view(metadataKey(MetadataField::ProtocolVersion)) == "logos_protocol_version");
+
+TEST(ProtocolVersionTest, Parse_AcceptsPartialAndSuffixedStamps) {
+    EXPECT_EQ(ProtocolVersion::parse("1.2.0"), (ProtocolVersion{1, 2, 0}));
+    EXPECT_EQ(ProtocolVersion::parse("3.4"), (ProtocolVersion{3, 4, 0}));
+    EXPECT_EQ(ProtocolVersion::parse("1.2.0-rc1"), (ProtocolVersion{1, 2, 0}));
+    EXPECT_EQ(ProtocolVersion::parse("1."), (ProtocolVersion{1, 0, 0}));
+}
+
+TEST(ProtocolVersionTest, Parse_RejectsNonNumericStamps) {
+    EXPECT_FALSE(ProtocolVersion::parse("").isValid());
+    EXPECT_FALSE(ProtocolVersion::parse("v1.2").isValid());
+    EXPECT_FALSE(ProtocolVersion::parse("99999999999").isValid());
+    EXPECT_FALSE(ProtocolVersion().isCompatibleWith(0));
+}
+
+TEST(ProtocolVersionTest, FromCustomMetadata_ParsesStampOnce) {
+    QJsonObject json;
+    json["name"] = "gated_plugin";
+    json["display_name"] = "Gated";
+    json["logos_protocol_version"] = "2.5.1";
+    json["dependencies"] = QJsonArray{"dep1"};
+
+    ModuleMetadata metadata = ModuleMetadata::fromCustomMetadata(json);
+
+    EXPECT_EQ(metadata.get<MetadataField::ProtocolVersion>(), (ProtocolVersion{2, 5, 1}));
+    EXPECT_EQ(metadata.get<MetadataField::Name>(), QString("gated_plugin"));
+    EXPECT_EQ(metadata.get<MetadataField::DisplayName>(), QString("Gated"));
+    EXPECT_EQ(metadata.get<MetadataField::Dependencies>(), QStringList{"dep1"});
+    EXPECT_TRUE(metadata.isCompatibleWith(2));
+    EXPECT_FALSE(metadata.isCompatibleWith(1));
+    EXPECT_TRUE(metadata.view().isCompatibleWith(2));
+}
+
+TEST(ProtocolVersionTest, Unstamped_IsCompatibleWithNothing) {
+    QJsonObject json;
+    json["name"] = "old_plugin";
+
+    ModuleMetadata metadata = ModuleMetadata::fromCustomMetadata(json);
+
+    EXPECT_FALSE(metadata.protocolVersion.isValid());
+    EXPECT_FALSE(metadata.isCompatibleWith(0));
+    EXPECT_FALSE(metadata.view().protocol.isValid());
+}
+
+// =============================================================================
+// MetadataView Tests
+// =============================================================================
+
+TEST(MetadataViewTest, FromMetadata_CopiesIdentityFields) {
+    QJsonObject json;
+    json["name"] = "view_plugin";
+    json["version"] = "3.1.0";
+    json["logos_protocol_version"] = "1.2.0";
+    QJsonArray deps;
+    deps.append("dep1");
+    deps.append("dep2");
+    json["dependencies"] = deps;
+
+    auto metadata = ModuleMetadata::fromCustomMetadata(json);
+    MetadataView view = metadata.view();
+
+    EXPECT_TRUE(view.isValid());
+    EXPECT_EQ(view.name, "view_plugin");
+    EXPECT_EQ(view.version, "3.1.0");
+    EXPECT_EQ(view.protocolVersion, "1.2.0");
+    EXPECT_EQ(view.dependencies, (std::vector<std::string>{"dep1", "dep2"}));
+    EXPECT_EQ(view.rawMetadataJson, metadata.rawMetadataJson);
+}
+
+TEST(MetadataViewTest, FromMetadata_UnstampedHasEmptyProtocolVersion) {
+    QJsonObject json;
+    json["name"] = "old_plugin";
+
+    MetadataView view = ModuleMetadata::fromCustomMetadata(json).view();
+
+    EXPECT_TRUE(view.isValid());
+    EXPECT_TRUE(view.protocolVersion.empty());
+    EXPECT_TRUE(view.dependencies.empty());
+}
+
+TEST(MetadataViewTest, GetMetadataView_InvalidFile_ReturnsNullopt) {
+    EXPECT_FALSE(LogosModule::getMetadataView("/dev/null").has_value());
+    EXPECT_FALSE(LogosModule::getMetadataView("/nonexistent/path/plugin.so").has_value());
+    EXPECT_FALSE(MetadataView::fromPath("").has_value());
+}
+
+TEST_F(RealPluginMetadataTest, GetMetadataView_MatchesSingleFieldHelpers) {
+    auto view = LogosModule::getMetadataView(testPlugin);
+
+    ASSERT_TRUE(view.has_value());
+    EXPECT_EQ(view->name, LogosModule::getModuleName(testPlugin));
+    EXPECT_EQ(view->dependencies, LogosModule::getModuleDependencies(testPlugin));
+    EXPECT_EQ(view->rawMetadataJson, LogosModule::getRawMetadataJson(testPlugin));
+}
+
+// =============================================================================
+// NativeMetadataReader Tests
+// =============================================================================
+
+TEST(NativeMetadataReaderTest, InvalidFiles_ReturnNullopt) {
+    std::string error;
+    EXPECT_FALSE(NativeMetadataReader::read("/dev/null", &error).has_value());
+    EXPECT_FALSE(error.empty());
+    EXPECT_FALSE(NativeMetadataReader::read("/nonexistent/path/plugin.so").has_value());
+    EXPECT_FALSE(NativeMetadataReader::read("").has_value());
+}
+
+TEST(NativeMetadataReaderTest, Decode_IntegerKeyedMap) {
+    // { 2: "x", 3: "C", 4: { "name": "n" } }
+    const unsigned char cbor[] = {
+        0xa3,
+        0x02, 0x61, 'x',
+        0x03, 0x61, 'C',
+        0x04, 0xa1, 0x64, 'n', 'a', 'm', 'e', 0x61, 'n',
+    };
+
+    auto result = NativeMetadataReader::decode(cbor, sizeof(cbor));
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->iid, "x");
+    EXPECT_EQ(result->className, "C");
+    EXPECT_EQ(result->metaDataJson, "{\"name\":\"n\"}");
+}
+
+TEST(NativeMetadataReaderTest, Decode_DoublesUseShortestForm) {
+    // { 4: { "x": 0.1, "y": 2.5 } } with 64-bit and 32-bit floats
+    const unsigned char cbor[] = {
+        0xa1, 0x04, 0xa2,
+        0x61, 'x', 0xfb, 0x3f, 0xb9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x9a,
+        0x61, 'y', 0xfa, 0x40, 0x20, 0x00, 0x00,
+    };
+
+    auto result = NativeMetadataReader::decode(cbor, sizeof(cbor));
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->metaDataJson, "{\"x\":0.1,\"y\":2.5}");
+}
+
+TEST(NativeMetadataReaderTest, Decode_WritesQtCompactForm) {
+    // { 4: { "b": 1, "a": 2, "a": 3, "u": 2^64 - 1, "n": -2^64 } }
+    const unsigned char cbor[] = {
+        0xa1, 0x04, 0xa5,
+        0x61, 'b', 0x01,
+        0x61, 'a', 0x02,
+        0x61, 'a', 0x03,
+        0x61, 'u', 0x1b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0x61, 'n', 0x3b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    };
+
+    auto result = NativeMetadataReader::decode(cbor, sizeof(cbor));
+
+    // Sorted keys, the last duplicate kept, out-of-range integers as doubles
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->metaDataJson,
+              R"({"a":3,"b":1,"n":-1.8446744073709552e+19,"u":1.8446744073709552e+19})");
+}
+
+TEST(NativeMetadataReaderTest, Decode_TruncatedPayload_ReturnsNullopt) {
+    const unsigned char cbor[] = { 0xa1, 0x04, 0xa1, 0x64, 'n', 'a' };
+
+    EXPECT_FALSE(NativeMetadataReader::decode(cbor, sizeof(cbor)).has_value());
+    EXPECT_FALSE(NativeMetadataReader::decode(cbor, 0).has_value());
+}
+
+namespace {
+
+void appendLE(QByteArray* out, std::uint64_t value, int width) {
+    for (int i = 0; i < width; ++i) {
+        out->append(static_cast<char>((value >> (8 * i)) & 0xff));
+    }
+}
+
+void appendName16(QByteArray* out, const char* name) {
+    QByteArray field(name);
+    field.resize(16, '\0');
+    out->append(field);
+}
+
+// A 64-bit Mach-O header announcing a single load command
+QByteArray machO64Header() {
+    QByteArray file;
+    appendLE(&file, 0xfeedfacf, 4);  // magic
+    appendLE(&file, 0x01000007, 4);  // cputype
+    appendLE(&file, 3, 4);           // cpusubtype
+    appendLE(&file, 6, 4);           // filetype (MH_DYLIB)
+    appendLE(&file, 1, 4);           // ncmds
+    appendLE(&file, 0, 4);           // sizeofcmds
+    appendLE(&file, 0, 4);           // flags
+    appendLE(&file, 0, 4);           // reserved
+    return file;
+}
+
+std::optional<NativeMetadataReader::PluginMetaData> readFixture(const QByteArray& content,
+                                                                std::string* error) {
+    QTemporaryDir tmpDir;
+    const QString path = tmpDir.filePath("fixture.bin");
+    if (!tmpDir.isValid() || !writeFile(path, content)) {
+        ADD_FAILURE() << "Cannot write fixture";
+        return std::nullopt;
+    }
+    return NativeMetadataReader::read(path.toStdString(), error);
+}
+
+} // namespace
+
+TEST(NativeMetadataReaderTest, MachO_TruncatedSegmentCommand_ReturnsNullopt) {
+    // An LC_SEGMENT_64 that stops right after its name: nsects would lie past the file
+    QByteArray file = machO64Header();
+    appendLE(&file, 0x19, 4);  // LC_SEGMENT_64
+    appendLE(&file, 24, 4);    // cmdsize, short of sizeof(segment_command_64)
+    appendName16(&file, "__TEXT");
+
+    std::string error;
+    EXPECT_FALSE(readFixture(file, &error).has_value());
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(NativeMetadataReaderTest, MachO_SectionCountOverrunsCommand_ReturnsNullopt) {
+    QByteArray file = machO64Header();
+    appendLE(&file, 0x19, 4);  // LC_SEGMENT_64
+    appendLE(&file, 72, 4);    // cmdsize: room for no section at all
+    appendName16(&file, "__TEXT");
+    file.append(QByteArray(8 * 4, '\0'));  // vmaddr, vmsize, fileoff, filesize
+    file.append(QByteArray(4 * 2, '\0'));  // maxprot, initprot
+    appendLE(&file, 0xffffffff, 4);       // nsects
+    appendLE(&file, 0, 4);                // flags
+
+    std::string error;
+    EXPECT_FALSE(readFixture(file, &error).has_value());
+    EXPECT_FALSE(error.empty());
+}
+
+TEST(NativeMetadataReaderTest, Elf_TruncatedSectionHeaders_ReturnsNullopt) {
+    // An ELF64 header whose section header table starts where the file ends
+    QByteArray file("\x7f" "ELF", 4);
+    file.append('\x02');  // ELFCLASS64
+    file.append('\x01');  // little-endian
+    file.append('\x01');  // version
+    file.append(QByteArray(9, '\0'));
+    appendLE(&file, 3, 2);    // e_type (ET_DYN)
+    appendLE(&file, 62, 2);   // e_machine
+    appendLE(&file, 1, 4);    // e_version
+    appendLE(&file, 0, 8);    // e_entry
+    appendLE(&file, 0, 8);    // e_phoff
+    appendLE(&file, 64, 8);   // e_shoff
+    appendLE(&file, 0, 4);    // e_flags
+    appendLE(&file, 64, 2);   // e_ehsize
+    appendLE(&file, 0, 2);    // e_phentsize
+    appendLE(&file, 0, 2);    // e_phnum
+    appendLE(&file, 64, 2);   // e_shentsize
+    appendLE(&file, 4, 2);    // e_shnum
+    appendLE(&file, 1, 2);    // e_shstrndx
+    ASSERT_EQ(file.size(), 64);
+
+    std::string error;
+    EXPECT_FALSE(readFixture(file, &error).has_value());
+    EXPECT_FALSE(error.empty());
+
+    // Half a section header table is no better
+    file.append(QByteArray(96, '\0'));
+    EXPECT_FALSE(readFixture(file, &error).has_value());
+}
+
+TEST_F(RealPluginMetadataTest, NativeReader_ReadsEmbeddedMetadata) {
+    auto result = NativeMetadataReader::read(testPlugin);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->className, "PackageManagerPlugin");
+    QJsonObject metaData = QJsonDocument::fromJson(
+        QByteArray::fromStdString(result->metaDataJson)).object();
+    EXPECT_EQ(metaData["name"].toString().toStdString(), "package_manager");
+}
+
+TEST_F(RealPluginMetadataTest, NativeReader_MatchesQPluginLoader) {
+    QPluginLoader loader(QString::fromStdString(testPlugin));
+    QJsonObject viaLoader = loader.metaData();
+    auto viaFromPath = ModuleMetadata::fromPath(testPlugin);
+
+    ASSERT_FALSE(viaLoader.isEmpty());
+    ASSERT_TRUE(viaFromPath.has_value());
+    EXPECT_EQ(viaFromPath->rawMetadata, viaLoader["MetaData"].toObject());
+    EXPECT_EQ(viaLoader["IID"].toString(),
+              QString::fromStdString(NativeMetadataReader::read(testPlugin)->iid));
+}
+
+// =============================================================================
+// Batch extraction Tests (fromPaths / fromDirectory)
+// =============================================================================
+
+TEST(MetadataBatchTest, FromPaths_Empty_ReturnsEmpty) {
+    EXPECT_TRUE(ModuleMetadata::fromPaths({}).empty());
+}
+
+TEST(MetadataBatchTest, FromPaths_InvalidFiles_ReportPerFileErrors) {
+    std::vector<std::string> paths = {"/dev/null", "/nonexistent/path/plugin.so"};
+
+    auto results = ModuleMetadata::fromPaths(paths);
+
+    ASSERT_EQ(results.size(), 2u);
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].path, paths[i]);
+        EXPECT_FALSE(results[i].ok());
+        EXPECT_FALSE(results[i].error.empty());
+    }
+}
+
+TEST(MetadataBatchTest, FromDirectory_MissingDirectory_ReturnsEmpty) {
+    EXPECT_TRUE(ModuleMetadata::fromDirectory("/nonexistent/modules/dir").empty());
+}
+
+TEST_F(RealPluginMetadataTest, FromPaths_PreservesInputOrder) {
+    // Interleave good and bad paths and use more paths than threads.
+    std::vector<std::string> paths;
+    for (int i = 0; i < 16; ++i) {
+        paths.push_back(i % 2 == 0 ? testPlugin : std::string("/dev/null"));
+    }
+
+    auto results = ModuleMetadata::fromPaths(paths, 4);
+
+    ASSERT_EQ(results.size(), paths.size());
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i].path, paths[i]);
+        EXPECT_EQ(results[i].ok(), i % 2 == 0);
+        if (results[i].ok()) {
+            EXPECT_EQ(results[i].metadata->name.toStdString(), "package_manager");
+            EXPECT_TRUE(results[i].error.empty());
+        }
+    }
+}
+
+TEST_F(RealPluginMetadataTest, FromDirectory_FindsExamplePlugin) {
+    std::string directory = testPlugin.substr(0, testPlugin.find_last_of('/'));
+
+    auto results = ModuleMetadata::fromDirectory(directory);
+
+    bool found = false;
+    for (const auto& result : results) {
+        if (result.ok() && result.metadata->name == "package_manager") {
+            found = true;
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
+TEST_F(RealPluginMetadataTest, FromDirectory_FilterSelectsFiles) {
+    std::string directory = testPlugin.substr(0, testPlugin.find_last_of('/'));
+
+    auto results = ModuleMetadata::fromDirectory(
+        directory, [](const std::string&) { return false; });
+
+    EXPECT_TRUE(results.empty());
+}
+
+// =============================================================================
+// LogosModule::loadAsync Tests
+// =============================================================================
+
+TEST(LoadAsyncTest, NonExistentPath_ResolvesToInvalidModule) {
+    std::future<LogosModule> future = LogosModule::loadAsync(
+        std::string("/nonexistent/path/to/plugin.so"));
+
+    LogosModule module = future.get();
+    EXPECT_FALSE(module.isValid());
+    EXPECT_FALSE(module.errorString().isEmpty());
+}
+
+TEST(LoadAsyncTest, ManyLoads_AllResolve) {
+    std::vector<std::future<LogosModule>> futures;
+    for (int i = 0; i < 8; ++i) {
+        futures.push_back(LogosModule::loadAsync(QStringLiteral("/dev/null")));
+    }
+    for (auto& future : futures) {
+        EXPECT_FALSE(future.get().isValid());
+    }
+}
+
+TEST(LoadAsyncTest, NullContext_DoesNotCrash) {
+    LogosModule::loadAsync(QStringLiteral("/dev/null"), nullptr,
+                           [](LogosModule) { FAIL() << "callback must not run"; });
+}
+
+// Like LoadFromPath_StdString_MatchesQStringOverload: the async path must
+// agree with the synchronous one whether or not dlopen succeeds here.
+TEST_F(RealPluginMetadataTest, LoadAsync_MatchesSynchronousLoad) {
+    LogosModule sync = LogosModule::loadFromPath(testPlugin);
+    LogosModule async = LogosModule::loadAsync(testPlugin).get();
+
+    EXPECT_EQ(async.isValid(), sync.isValid());
+    if (async.isValid()) {
+        EXPECT_EQ(async.instance()->thread(), QThread::currentThread());
+        EXPECT_EQ(async.metadata().name, sync.metadata().name);
+    }
+}
+
+// =============================================================================
+// LogosModule::lazyFromPath Tests
+// =============================================================================
+
+TEST(LazyFromPathTest, NonExistentPath_ReturnsInvalidModule) {
+    std::string errorString;
+    LogosModule module = LogosModule::lazyFromPath(
+        std::string("/nonexistent/path/to/plugin.so"), &errorString);
+
+    EXPECT_FALSE(module.isValid());
+    EXPECT_FALSE(module.isLoaded());
+    EXPECT_FALSE(errorString.empty());
+    EXPECT_EQ(module.instance(), nullptr);
+}
+
+TEST_F(RealPluginMetadataTest, LazyFromPath_MetadataWithoutLoading) {
+    LogosModule module = LogosModule::lazyFromPath(testPlugin);
+
+    EXPECT_TRUE(module.isValid());
+    EXPECT_FALSE(module.isLoaded());
+    EXPECT_EQ(module.metadata().name.toStdString(), "package_manager");
+    EXPECT_FALSE(module.isLoaded());
+}
+
+TEST_F(RealPluginMetadataTest, LazyFromPath_FirstTouchMatchesSynchronousLoad) {
+    LogosModule sync = LogosModule::loadFromPath(testPlugin);
+    LogosModule lazy = LogosModule::lazyFromPath(testPlugin);
+
+    QObject* instance = lazy.instance();
+    EXPECT_EQ(instance != nullptr, sync.isValid());
+    EXPECT_EQ(lazy.isValid(), sync.isValid());
+    EXPECT_EQ(lazy.isLoaded(), sync.isValid());
+    EXPECT_EQ(lazy.instance(), instance);
+}
+
+TEST_F(RealPluginMetadataTest, LazyFromPath_ConcurrentFirstTouchLoadsOnce) {
+    LogosModule lazy = LogosModule::lazyFromPath(testPlugin);
+
+    constexpr int threadCount = 4;
+    std::vector<QObject*> instances(threadCount, nullptr);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&lazy, &instances, i]() { instances[i] = lazy.instance(); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (QObject* instance : instances) {
+        EXPECT_EQ(instance, instances.front());
+    }
+}
+
+TEST_F(RealPluginMetadataTest, LazyFromPath_ConcurrentFirstIntrospectionBuildsOnce) {
+    LogosModule lazy = LogosModule::lazyFromPath(testPlugin);
+
+    constexpr int threadCount = 4;
+    std::vector<const InterfaceTable*> tables(threadCount, nullptr);
+    std::vector<std::size_t> methodCounts(threadCount, 0);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&lazy, &tables, &methodCounts, i]() {
+            methodCounts[i] = lazy.getMethods().size();
+            tables[i] = &lazy.interfaceTable();
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < threadCount; ++i) {
+        EXPECT_EQ(tables[i], tables.front());
+        EXPECT_EQ(methodCounts[i], methodCounts.front());
+    }
+    EXPECT_EQ(lazy.getMethods().size(), methodCounts.front());
+}
+
+TEST_F(RealPluginMetadataTest, LazyFromPath_UnloadBeforeUse) {
+    LogosModule lazy = LogosModule::lazyFromPath(testPlugin);
+    lazy.unload();
+
+    EXPECT_FALSE(lazy.isValid());
+    EXPECT_EQ(lazy.instance(), nullptr);
+}
+
+// =============================================================================
+// LogosModule::loadShared Tests
+// =============================================================================
+
+TEST(LoadSharedTest, NonExistentPath_ReturnsInvalidModule) {
+    std::string errorString;
+    LogosModule module = LogosModule::loadShared(
+        std::string("/nonexistent/path/to/plugin.so"), &errorString);
+
+    EXPECT_FALSE(module.isValid());
+    EXPECT_FALSE(module.isShared());
+    EXPECT_FALSE(errorString.empty());
+}
+
+TEST_F(RealPluginMetadataTest, LoadShared_HandlesShareOneInstance) {
+    LogosModule first = LogosModule::loadShared(testPlugin);
+    if (!first.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+    const std::size_t sharedBefore = LogosModule::sharedLoadCount();
+
+    // A different spelling of the same file resolves to the same entry
+    QFileInfo info(QString::fromStdString(testPlugin));
+    LogosModule second = LogosModule::loadShared(info.dir().filePath("./" + info.fileName()));
+
+    ASSERT_TRUE(second.isValid());
+    EXPECT_TRUE(first.isShared());
+    EXPECT_TRUE(second.isShared());
+    EXPECT_EQ(second.instance(), first.instance());
+    EXPECT_EQ(second.metadata().name, first.metadata().name);
+    EXPECT_EQ(LogosModule::sharedLoadCount(), sharedBefore);
+
+    // Dropping one handle leaves the plugin loaded for the other
+    first.unload();
+    EXPECT_FALSE(first.isValid());
+    EXPECT_TRUE(second.isValid());
+    EXPECT_FALSE(second.getMethodsAsJson().isEmpty());
+
+    second.unload();
+    EXPECT_EQ(LogosModule::sharedLoadCount(), sharedBefore - 1);
+}
+
+TEST_F(RealPluginMetadataTest, LoadShared_MovedHandleKeepsReference) {
+    LogosModule original = LogosModule::loadShared(testPlugin);
+    if (!original.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+    QObject* instance = original.instance();
+
+    LogosModule moved = std::move(original);
+    EXPECT_TRUE(moved.isShared());
+    EXPECT_EQ(moved.instance(), instance);
+    EXPECT_EQ(LogosModule::loadShared(testPlugin).instance(), instance);
+}
+
+TEST_F(RealPluginMetadataTest, LoadShared_RepeatedAbsolutePathIsLookedUpAsGiven) {
+    QTemporaryDir dir;
+    ASSERT_TRUE(dir.isValid());
+    const QString link = dir.filePath("alias_plugin." + testPluginSuffix(testPlugin));
+    ASSERT_TRUE(QFile::link(QFileInfo(QString::fromStdString(testPlugin)).absoluteFilePath(), link));
+
+    LogosModule first = LogosModule::loadShared(link);
+    if (!first.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+
+    // Without the link the path no longer resolves: only the registry can answer
+    ASSERT_TRUE(QFile::remove(link));
+    LogosModule second = LogosModule::loadShared(link);
+    ASSERT_TRUE(second.isValid());
+    EXPECT_EQ(second.instance(), first.instance());
+}
+
+TEST_F(RealPluginMetadataTest, LoadShared_ConcurrentFirstLoadsShareOneEntry) {
+    const std::size_t sharedBefore = LogosModule::sharedLoadCount();
+
+    constexpr int threadCount = 4;
+    std::vector<LogosModule> handles(threadCount);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([this, &handles, i]() { handles[i] = LogosModule::loadShared(testPlugin); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    if (!handles.front().isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+
+    EXPECT_EQ(LogosModule::sharedLoadCount(), sharedBefore + 1);
+    for (const LogosModule& handle : handles) {
+        EXPECT_EQ(handle.instance(), handles.front().instance());
+        EXPECT_FALSE(handle.getMethodsAsJson().isEmpty());
+    }
+}
+
+// =============================================================================
+// LoadStats of loadFromPath
+// =============================================================================
+
+TEST(LoadStatsLoadTest, MissingFile_StopsAfterLibraryLoad) {
+    LogosModule module = LogosModule::loadFromPath(QString("/nonexistent/path/to/plugin.so"));
+
+    EXPECT_FALSE(module.isValid());
+    EXPECT_GE(module.loadStats().metadataReadNs, 0);
+    EXPECT_GE(module.loadStats().libraryLoadNs, 0);
+    EXPECT_EQ(module.loadStats().instanceNs, -1);
+}
+
+TEST_F(RealPluginMetadataTest, LoadStats_RecordsEveryLoadPhase) {
+    LogosModule module = LogosModule::loadFromPath(testPlugin);
+    if (!module.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+
+    const LoadStats& stats = module.loadStats();
+    EXPECT_GE(stats.metadataReadNs, 0);
+    EXPECT_GE(stats.libraryLoadNs, 0);
+    EXPECT_GE(stats.instanceNs, 0);
+    EXPECT_EQ(stats.loadNs(), stats.metadataReadNs + stats.libraryLoadNs + stats.instanceNs);
+    EXPECT_EQ(stats.fileSize, QFileInfo(QString::fromStdString(testPlugin)).size());
+    EXPECT_GT(stats.metadataBytes, 0);
+}
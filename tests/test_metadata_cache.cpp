@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include "metadata_cache.h"
+#include "logos_module.h"
+#include "test_plugin_path.h"
+#include <QFile>
+#include <QTemporaryDir>
+#include <string>
+
+using namespace ModuleLib;
+
+// =============================================================================
+// FileIdentity Tests
+// =============================================================================
+
+TEST(FileIdentityTest, NonExistentPath_ReturnsNullopt) {
+    EXPECT_FALSE(FileIdentity::of("/nonexistent/path/plugin.so").has_value());
+    EXPECT_FALSE(FileIdentity::of("").has_value());
+}
+
+TEST(FileIdentityTest, SameFile_SameIdentity) {
+    auto first = FileIdentity::of("/dev/null");
+    auto second = FileIdentity::of("/dev/null");
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(*first, *second);
+}
+
+// =============================================================================
+// MetadataCache Tests
+// =============================================================================
+
+TEST(MetadataCacheTest, GlobalCache_DisabledByDefault) {
+    EXPECT_FALSE(MetadataCache::global().isEnabled());
+}
+
+TEST(MetadataCacheTest, NonExistentPath_ReturnsNulloptAndCachesNothing) {
+    MetadataCache cache;
+
+    EXPECT_FALSE(cache.get(QString("/nonexistent/path/plugin.so")).has_value());
+    EXPECT_FALSE(cache.get(std::string("")).has_value());
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST(MetadataCacheTest, InvalidFile_CachesFailedRead) {
+    MetadataCache cache;
+
+    EXPECT_FALSE(cache.get(QString("/dev/null")).has_value());
+    EXPECT_EQ(cache.size(), 1u);
+
+    cache.invalidate(QString("/dev/null"));
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+class MetadataCachePluginTest : public ::testing::Test {
+protected:
+    std::string testPlugin;
+    QTemporaryDir tmpDir;
+
+    void SetUp() override {
+        testPlugin = findTestPlugin();
+        if (testPlugin.empty()) {
+            GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+        }
+        ASSERT_TRUE(tmpDir.isValid());
+    }
+
+    // Copy the test plugin into the temp dir so the test may rewrite it.
+    QString copyPlugin() {
+        QString copy = tmpDir.filePath("plugin_copy." + testPluginSuffix(testPlugin));
+        QFile::remove(copy);
+        EXPECT_TRUE(QFile::copy(QString::fromStdString(testPlugin), copy));
+        return copy;
+    }
+};
+
+TEST_F(MetadataCachePluginTest, RepeatedGet_ReturnsSameMetadata) {
+    MetadataCache cache;
+
+    auto first = cache.get(testPlugin);
+    auto second = cache.get(testPlugin);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(first->name.toStdString(), "package_manager");
+    EXPECT_EQ(first->rawMetadataJson, second->rawMetadataJson);
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST_F(MetadataCachePluginTest, ChangedFile_IsReadAgain) {
+    MetadataCache cache;
+    QString copy = copyPlugin();
+
+    ASSERT_TRUE(cache.get(copy).has_value());
+
+    // Replace the plugin with garbage: the new size/mtime must invalidate.
+    QFile file(copy);
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+    file.write("not a plugin");
+    file.close();
+
+    EXPECT_FALSE(cache.get(copy).has_value());
+}
+
+TEST_F(MetadataCachePluginTest, RemovedFile_DropsEntry) {
+    MetadataCache cache;
+    QString copy = copyPlugin();
+
+    ASSERT_TRUE(cache.get(copy).has_value());
+    ASSERT_TRUE(QFile::remove(copy));
+
+    EXPECT_FALSE(cache.get(copy).has_value());
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(MetadataCachePluginTest, Clear_DropsAllEntries) {
+    MetadataCache cache;
+
+    cache.get(testPlugin);
+    cache.get(QString("/dev/null"));
+    EXPECT_EQ(cache.size(), 2u);
+
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(MetadataCachePluginTest, GlobalCache_ServesExtractMetadata) {
+    MetadataCache& cache = MetadataCache::global();
+    cache.clear();
+    cache.setEnabled(true);
+
+    auto viaExtract = LogosModule::extractMetadata(testPlugin);
+    EXPECT_EQ(cache.size(), 1u);
+    EXPECT_EQ(LogosModule::getModuleName(testPlugin), "package_manager");
+    EXPECT_EQ(cache.size(), 1u);
+
+    cache.setEnabled(false);
+    cache.clear();
+
+    ASSERT_TRUE(viaExtract.has_value());
+    EXPECT_EQ(viaExtract->name.toStdString(), "package_manager");
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include "metadata_index.h"
+#include "logos_module.h"
+#include "test_plugin_path.h"
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <string>
+
+using namespace ModuleLib;
+
+// =============================================================================
+// MetadataIndex without an index file
+// =============================================================================
+
+TEST(MetadataIndexTest, Load_NoIndex_ReturnsNullopt) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+
+    EXPECT_FALSE(MetadataIndex::load(tmpDir.path()).has_value());
+    EXPECT_FALSE(MetadataIndex::lookup(tmpDir.filePath("plugin.so")).has_value());
+}
+
+TEST(MetadataIndexTest, Load_CorruptIndex_ReturnsNullopt) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+
+    QFile file(MetadataIndex::indexPath(tmpDir.path()));
+    ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+    file.write("{ not json");
+    file.close();
+
+    EXPECT_FALSE(MetadataIndex::load(tmpDir.path()).has_value());
+}
+
+TEST(MetadataIndexTest, Build_MissingDirectory_Fails) {
+    QString error;
+    EXPECT_FALSE(MetadataIndex::build("/nonexistent/modules/dir", &error));
+    EXPECT_FALSE(error.isEmpty());
+}
+
+TEST(MetadataIndexTest, Build_EmptyDirectory_WritesEmptyIndex) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+
+    int count = -1;
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path(), nullptr, &count));
+    EXPECT_EQ(count, 0);
+
+    auto index = MetadataIndex::load(tmpDir.path());
+    ASSERT_TRUE(index.has_value());
+    EXPECT_TRUE(index->fileNames().isEmpty());
+}
+
+// =============================================================================
+// MetadataIndex over a directory holding the example plugin
+// =============================================================================
+
+class MetadataIndexPluginTest : public ::testing::Test {
+protected:
+    std::string testPlugin;
+    QTemporaryDir tmpDir;
+    QString pluginCopy;
+
+    void SetUp() override {
+        testPlugin = findTestPlugin();
+        if (testPlugin.empty()) {
+            GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+        }
+        ASSERT_TRUE(tmpDir.isValid());
+        pluginCopy = tmpDir.filePath("package_manager_plugin." + testPluginSuffix(testPlugin));
+        ASSERT_TRUE(QFile::copy(QString::fromStdString(testPlugin), pluginCopy));
+    }
+
+    // Rewrite the indexed name of the plugin, keeping its identity fields, so
+    // a test can tell an index hit from a read of the binary.
+    void renameInIndex(const QString& newName) {
+        QFile file(MetadataIndex::indexPath(tmpDir.path()));
+        ASSERT_TRUE(file.open(QIODevice::ReadOnly));
+        QJsonObject root = QJsonDocument::fromJson(file.readAll()).object();
+        file.close();
+
+        QJsonObject modules = root["modules"].toObject();
+        const QString fileName = QFileInfo(pluginCopy).fileName();
+        QJsonObject entry = modules[fileName].toObject();
+        QJsonObject metadata = QJsonDocument::fromJson(entry["metadata"].toString().toUtf8()).object();
+        metadata["name"] = newName;
+        entry["metadata"] = QString::fromUtf8(QJsonDocument(metadata).toJson(QJsonDocument::Compact));
+        modules[fileName] = entry;
+        root["modules"] = modules;
+
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly | QIODevice::Truncate));
+        file.write(QJsonDocument(root).toJson());
+        file.close();
+    }
+};
+
+TEST_F(MetadataIndexPluginTest, Build_RecordsPlugin) {
+    int count = 0;
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path(), nullptr, &count));
+    EXPECT_EQ(count, 1);
+
+    auto index = MetadataIndex::load(tmpDir.path());
+    ASSERT_TRUE(index.has_value());
+    ASSERT_EQ(index->fileNames().size(), 1);
+
+    auto metadata = index->find(index->fileNames().first());
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->name.toStdString(), "package_manager");
+}
+
+TEST_F(MetadataIndexPluginTest, Find_RawJsonMatchesPluginRead) {
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path()));
+
+    auto fromIndex = MetadataIndex::lookup(pluginCopy);
+    auto fromBinary = ModuleMetadata::fromPath(pluginCopy);
+    ASSERT_TRUE(fromIndex.has_value());
+    ASSERT_TRUE(fromBinary.has_value());
+    EXPECT_EQ(fromIndex->rawMetadataJson, fromBinary->rawMetadataJson);
+    EXPECT_EQ(fromIndex->rawMetadata, fromBinary->rawMetadata);
+}
+
+TEST_F(MetadataIndexPluginTest, Lookup_ServesExtractMetadataFromIndex) {
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path()));
+    renameInIndex("from_index");
+
+    auto metadata = LogosModule::extractMetadata(pluginCopy);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->name.toStdString(), "from_index");
+    EXPECT_EQ(LogosModule::getModuleName(pluginCopy.toStdString()), "from_index");
+}
+
+TEST_F(MetadataIndexPluginTest, Lookup_StaleEntry_FallsBackToBinary) {
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path()));
+    renameInIndex("from_index");
+
+    // Replacing the plugin changes its identity, so the entry is not trusted.
+    ASSERT_TRUE(QFile::remove(pluginCopy));
+    ASSERT_TRUE(QFile::copy(QString::fromStdString(testPlugin), pluginCopy));
+
+    EXPECT_FALSE(MetadataIndex::lookup(pluginCopy).has_value());
+    auto metadata = LogosModule::extractMetadata(pluginCopy);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->name.toStdString(), "package_manager");
+}
+
+TEST_F(MetadataIndexPluginTest, Build_Refresh_ReusesFreshEntries) {
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path()));
+    renameInIndex("from_index");
+
+    // The plugin is unchanged, so a refresh keeps its existing entry.
+    ASSERT_TRUE(MetadataIndex::build(tmpDir.path()));
+    auto metadata = MetadataIndex::lookup(pluginCopy);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->name.toStdString(), "from_index");
+}
@@ -0,0 +1,180 @@
+#include <gtest/gtest.h>
+#include "module_graph.h"
+#include "test_plugin_path.h"
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QObject>
+#include <string>
+#include <vector>
+
+using namespace ModuleLib;
+
+namespace {
+
+MetadataResult moduleResult(const std::string& name, const QStringList& dependencies = {}) {
+    QJsonObject json;
+    json["name"] = QString::fromStdString(name);
+    json["dependencies"] = QJsonArray::fromStringList(dependencies);
+
+    MetadataResult result;
+    result.path = "/modules/" + name + "_plugin.so";
+    result.metadata = ModuleMetadata::fromCustomMetadata(json);
+    return result;
+}
+
+std::vector<std::string> waveNames(const ModuleGraph& graph, std::size_t wave) {
+    std::vector<std::string> names;
+    for (std::size_t i : graph.waves()[wave]) {
+        names.push_back(graph.modules()[i].metadata.name.toStdString());
+    }
+    return names;
+}
+
+} // namespace
+
+// =============================================================================
+// Ordering
+// =============================================================================
+
+TEST(ModuleGraphTest, Empty_IsValidWithNoWaves) {
+    ModuleGraph graph = ModuleGraph::fromMetadata({});
+
+    EXPECT_TRUE(graph.isValid());
+    EXPECT_TRUE(graph.waves().empty());
+    EXPECT_TRUE(graph.loadOrder().empty());
+}
+
+TEST(ModuleGraphTest, IndependentModules_ShareOneWave) {
+    ModuleGraph graph = ModuleGraph::fromMetadata({moduleResult("a"), moduleResult("b")});
+
+    ASSERT_TRUE(graph.isValid());
+    ASSERT_EQ(graph.waves().size(), 1u);
+    EXPECT_EQ(waveNames(graph, 0), (std::vector<std::string>{"a", "b"}));
+}
+
+TEST(ModuleGraphTest, Diamond_OrdersByDependencyLevel) {
+    // d depends on b and c, which both depend on a; listed backwards
+    ModuleGraph graph = ModuleGraph::fromMetadata({
+        moduleResult("d", {"b", "c"}),
+        moduleResult("c", {"a"}),
+        moduleResult("b", {"a"}),
+        moduleResult("a"),
+    });
+
+    ASSERT_TRUE(graph.isValid());
+    ASSERT_EQ(graph.waves().size(), 3u);
+    EXPECT_EQ(waveNames(graph, 0), (std::vector<std::string>{"a"}));
+    EXPECT_EQ(waveNames(graph, 1), (std::vector<std::string>{"c", "b"}));
+    EXPECT_EQ(waveNames(graph, 2), (std::vector<std::string>{"d"}));
+
+    std::vector<std::string> order = graph.loadOrder();
+    ASSERT_EQ(order.size(), 4u);
+    EXPECT_EQ(order.front(), "/modules/a_plugin.so");
+    EXPECT_EQ(order.back(), "/modules/d_plugin.so");
+}
+
+// =============================================================================
+// Problems
+// =============================================================================
+
+TEST(ModuleGraphTest, MissingDependency_ReportedAndBlocksDependents) {
+    ModuleGraph graph = ModuleGraph::fromMetadata({
+        moduleResult("a", {"ghost"}),
+        moduleResult("b", {"a"}),
+        moduleResult("c"),
+    });
+
+    EXPECT_FALSE(graph.isValid());
+    ASSERT_EQ(graph.errors().size(), 1u);
+    EXPECT_NE(graph.errors()[0].find("ghost"), std::string::npos);
+    EXPECT_TRUE(graph.cycles().empty());
+    EXPECT_EQ(graph.unresolved(), (std::vector<std::string>{"a", "b"}));
+    EXPECT_EQ(graph.loadOrder(), (std::vector<std::string>{"/modules/c_plugin.so"}));
+}
+
+TEST(ModuleGraphTest, Cycle_Detected) {
+    ModuleGraph graph = ModuleGraph::fromMetadata({
+        moduleResult("a", {"b"}),
+        moduleResult("b", {"c"}),
+        moduleResult("c", {"a"}),
+        moduleResult("d", {"a"}),
+    });
+
+    EXPECT_FALSE(graph.isValid());
+    ASSERT_EQ(graph.cycles().size(), 1u);
+    EXPECT_EQ(graph.cycles()[0], (std::vector<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(graph.unresolved().size(), 4u);
+    EXPECT_TRUE(graph.waves().empty());
+}
+
+TEST(ModuleGraphTest, SelfDependency_IsACycle) {
+    ModuleGraph graph = ModuleGraph::fromMetadata({moduleResult("a", {"a"})});
+
+    ASSERT_EQ(graph.cycles().size(), 1u);
+    EXPECT_EQ(graph.cycles()[0], (std::vector<std::string>{"a"}));
+}
+
+TEST(ModuleGraphTest, DuplicateName_KeepsFirst) {
+    MetadataResult second = moduleResult("a");
+    second.path = "/other/a_plugin.so";
+    ModuleGraph graph = ModuleGraph::fromMetadata({moduleResult("a"), second});
+
+    EXPECT_FALSE(graph.isValid());
+    ASSERT_EQ(graph.modules().size(), 1u);
+    EXPECT_EQ(graph.modules()[0].path, "/modules/a_plugin.so");
+}
+
+TEST(ModuleGraphTest, UnreadableFile_Reported) {
+    ModuleGraph graph = ModuleGraph::fromPaths(
+        std::vector<std::string>{"/nonexistent/path/to/plugin.so"});
+
+    EXPECT_FALSE(graph.isValid());
+    EXPECT_TRUE(graph.modules().empty());
+    ASSERT_EQ(graph.errors().size(), 1u);
+    EXPECT_EQ(graph.errors()[0].rfind("/nonexistent/path/to/plugin.so", 0), 0u);
+}
+
+TEST(ModuleGraphTest, InvalidGraph_LoadsNothing) {
+    ModuleGraph graph = ModuleGraph::fromMetadata({moduleResult("a", {"ghost"})});
+
+    QString error;
+    EXPECT_TRUE(graph.load(&error).empty());
+    EXPECT_FALSE(error.isEmpty());
+}
+
+TEST(LoadedModulesTest, MoveAndClear) {
+    QObject first;
+    QObject second;
+    std::vector<LogosModule> handles;
+    handles.push_back(LogosModule::wrapExisting(&first));
+    handles.push_back(LogosModule::wrapExisting(&second));
+
+    LoadedModules modules(std::move(handles));
+    ASSERT_EQ(modules.size(), 2u);
+    EXPECT_EQ(modules[0].instance(), &first);
+    EXPECT_EQ(modules[1].instance(), &second);
+
+    LoadedModules moved;
+    moved = std::move(modules);
+    EXPECT_EQ(moved.size(), 2u);
+
+    moved.clear();
+    EXPECT_TRUE(moved.empty());
+}
+
+// =============================================================================
+// Real plugin
+// =============================================================================
+
+TEST(ModuleGraphTest, RealPlugin_SingleWave) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    ModuleGraph graph = ModuleGraph::fromPaths(std::vector<std::string>{testPlugin});
+
+    ASSERT_TRUE(graph.isValid());
+    ASSERT_EQ(graph.waves().size(), 1u);
+    EXPECT_EQ(waveNames(graph, 0), (std::vector<std::string>{"package_manager"}));
+}
@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include "module_watcher.h"
+#include "logos_module.h"
+#include "metadata_cache.h"
+#include "test_plugin_path.h"
+#include <QFile>
+#include <QTemporaryDir>
+#include <string>
+
+using namespace ModuleLib;
+
+namespace {
+
+// Records the watcher's signals, in emission order
+struct SignalLog {
+    QStringList added;
+    QStringList changed;
+    QStringList removed;
+
+    explicit SignalLog(ModuleWatcher& watcher) {
+        QObject::connect(&watcher, &ModuleWatcher::moduleAdded,
+                         [this](const QString& path) { added.append(path); });
+        QObject::connect(&watcher, &ModuleWatcher::moduleChanged,
+                         [this](const QString& path) { changed.append(path); });
+        QObject::connect(&watcher, &ModuleWatcher::moduleRemoved,
+                         [this](const QString& path) { removed.append(path); });
+    }
+
+    void clear() {
+        added.clear();
+        changed.clear();
+        removed.clear();
+    }
+};
+
+} // namespace
+
+// =============================================================================
+// Directory changes
+// =============================================================================
+
+TEST(ModuleWatcherTest, AddDirectory_MissingDirectory_Fails) {
+    MetadataCache cache;
+    ModuleWatcher watcher(cache);
+
+    EXPECT_FALSE(watcher.addDirectory(QString("/nonexistent/modules")));
+    EXPECT_TRUE(watcher.directories().isEmpty());
+}
+
+TEST(ModuleWatcherTest, AddDirectory_ReportsExistingPluginsOnly) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    ASSERT_TRUE(writeFile(tmpDir.filePath("a_plugin.so"), "a"));
+    ASSERT_TRUE(writeFile(tmpDir.filePath("notes.txt"), "not a plugin"));
+
+    MetadataCache cache;
+    ModuleWatcher watcher(cache);
+    SignalLog log(watcher);
+    ASSERT_TRUE(watcher.addDirectory(tmpDir.path()));
+
+    EXPECT_EQ(log.added, QStringList{tmpDir.filePath("a_plugin.so")});
+    EXPECT_EQ(watcher.modulePaths(), QStringList{tmpDir.filePath("a_plugin.so")});
+    EXPECT_FALSE(watcher.metadata(tmpDir.filePath("a_plugin.so")).has_value());
+}
+
+TEST(ModuleWatcherTest, Rescan_ReportsOnlyWhatChanged) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString a = tmpDir.filePath("a_plugin.so");
+    const QString b = tmpDir.filePath("b_plugin.so");
+    const QString c = tmpDir.filePath("c_plugin.so");
+    ASSERT_TRUE(writeFile(a, "a"));
+    ASSERT_TRUE(writeFile(b, "b"));
+
+    MetadataCache cache;
+    ModuleWatcher watcher(cache);
+    SignalLog log(watcher);
+    ASSERT_TRUE(watcher.addDirectory(tmpDir.path()));
+    log.clear();
+
+    watcher.rescan();
+    EXPECT_TRUE(log.added.isEmpty());
+    EXPECT_TRUE(log.changed.isEmpty());
+    EXPECT_TRUE(log.removed.isEmpty());
+
+    ASSERT_TRUE(writeFile(a, "rewritten a"));
+    ASSERT_TRUE(QFile::remove(b));
+    ASSERT_TRUE(writeFile(c, "c"));
+    watcher.rescan();
+
+    EXPECT_EQ(log.added, QStringList{c});
+    EXPECT_EQ(log.changed, QStringList{a});
+    EXPECT_EQ(log.removed, QStringList{b});
+    EXPECT_EQ(watcher.modulePaths(), (QStringList{a, c}));
+}
+
+TEST(ModuleWatcherTest, RemoveDirectory_ForgetsPluginsSilently) {
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    ASSERT_TRUE(writeFile(tmpDir.filePath("a_plugin.so"), "a"));
+
+    MetadataCache cache;
+    ModuleWatcher watcher(cache);
+    SignalLog log(watcher);
+    ASSERT_TRUE(watcher.addDirectory(tmpDir.path()));
+    watcher.removeDirectory(tmpDir.path());
+
+    EXPECT_TRUE(watcher.directories().isEmpty());
+    EXPECT_TRUE(watcher.modulePaths().isEmpty());
+    EXPECT_TRUE(log.removed.isEmpty());
+}
+
+// =============================================================================
+// Metadata and reload with the example plugin
+// =============================================================================
+
+TEST(ModuleWatcherTest, RealPlugin_MetadataFedThroughCache) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    QTemporaryDir tmpDir;
+    ASSERT_TRUE(tmpDir.isValid());
+    const QString copy = tmpDir.filePath("package_manager_plugin." + testPluginSuffix(testPlugin));
+    ASSERT_TRUE(QFile::copy(QString::fromStdString(testPlugin), copy));
+
+    MetadataCache cache;
+    ModuleWatcher watcher(cache);
+    ASSERT_TRUE(watcher.addDirectory(tmpDir.path()));
+
+    auto metadata = watcher.metadata(copy);
+    ASSERT_TRUE(metadata.has_value());
+    EXPECT_EQ(metadata->name, QString("package_manager"));
+    EXPECT_EQ(cache.size(), 1u);
+
+    // Replacing the plugin with garbage is a change with no readable metadata
+    ASSERT_TRUE(QFile::remove(copy));
+    ASSERT_TRUE(writeFile(copy, "garbage"));
+    SignalLog log(watcher);
+    watcher.rescan();
+
+    EXPECT_EQ(log.changed, QStringList{copy});
+    EXPECT_FALSE(watcher.metadata(copy).has_value());
+}
+
+TEST(LogosModuleReloadTest, WrappedModule_CannotReload) {
+    QObject object;
+    LogosModule module = LogosModule::wrapExisting(&object);
+    EXPECT_TRUE(module.pluginPath().isEmpty());
+
+    QString error;
+    EXPECT_FALSE(module.reload(&error));
+    EXPECT_FALSE(error.isEmpty());
+}
+
+TEST(LogosModuleReloadTest, LazyHandle_StaysLazy) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    LogosModule lazy = LogosModule::lazyFromPath(testPlugin);
+    ASSERT_TRUE(lazy.isValid());
+    EXPECT_EQ(lazy.pluginPath(), QString::fromStdString(testPlugin));
+
+    std::string error;
+    EXPECT_TRUE(lazy.reload(&error)) << error;
+    EXPECT_FALSE(lazy.isLoaded());
+    EXPECT_EQ(lazy.metadata().name, QString("package_manager"));
+}
+
+TEST(LogosModuleReloadTest, LoadedModule_ReloadsFromSameFile) {
+    const std::string testPlugin = findTestPlugin();
+    if (testPlugin.empty()) {
+        GTEST_SKIP() << "Test plugin not found. Set TEST_PLUGIN environment variable.";
+    }
+
+    // Full dlopen can fail in headless CI; only check the reload if it works
+    LogosModule module = LogosModule::loadFromPath(testPlugin);
+    if (!module.isValid()) {
+        GTEST_SKIP() << "Example plugin cannot be loaded here";
+    }
+    const QJsonArray methods = module.getMethodsAsJson();
+
+    QString error;
+    ASSERT_TRUE(module.reload(&error)) << error.toStdString();
+    EXPECT_TRUE(module.isLoaded());
+    EXPECT_EQ(module.metadata().name, QString("package_manager"));
+    EXPECT_EQ(module.getMethodsAsJson(), methods);
+}
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "output_capture.h"
+#include "logos_module.h"
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ModuleLib;
+
+// =============================================================================
+// OutputCapture
+// =============================================================================
+
+TEST(OutputCaptureTest, Capture_CollectsStdoutAndStderr) {
+    OutputCapture capture(OutputCapture::Capture);
+    ASSERT_TRUE(capture.isActive());
+    std::printf("to stdout\n");
+    std::fprintf(stderr, "to stderr\n");
+    const QByteArray output = capture.finish();
+
+    EXPECT_FALSE(capture.isActive());
+    EXPECT_TRUE(output.contains("to stdout\n"));
+    EXPECT_TRUE(output.contains("to stderr\n"));
+    EXPECT_TRUE(capture.finish().isEmpty());
+}
+
+TEST(OutputCaptureTest, Discard_ReturnsNothing) {
+    OutputCapture capture(OutputCapture::Discard);
+    std::printf("dropped\n");
+
+    EXPECT_TRUE(capture.finish().isEmpty());
+}
+
+TEST(OutputCaptureTest, LargeOutput_DoesNotBlock) {
+    const std::string line(1023, 'x');
+    OutputCapture capture;
+    for (int i = 0; i < 256; ++i) {
+        std::printf("%s\n", line.c_str());
+    }
+
+    EXPECT_EQ(capture.finish().size(), 256 * 1024);
+}
+
+TEST(OutputCaptureTest, Nested_EachKeepsItsOwnOutput) {
+    OutputCapture outer;
+    std::printf("outer\n");
+    QByteArray inner;
+    {
+        OutputCapture nested;
+        std::printf("inner\n");
+        inner = nested.finish();
+    }
+    std::printf("outer again\n");
+    const QByteArray output = outer.finish();
+
+    EXPECT_EQ(inner, QByteArray("inner\n"));
+    EXPECT_EQ(output, QByteArray("outer\nouter again\n"));
+}
+
+TEST(OutputCaptureTest, ConcurrentCaptures_AreSerialized) {
+    constexpr int threadCount = 4;
+    std::vector<QByteArray> outputs(threadCount);
+    std::vector<std::thread> threads;
+    for (int i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&outputs, i]() {
+            OutputCapture capture;
+            std::printf("thread %d\n", i);
+            outputs[i] = capture.finish();
+        });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < threadCount; ++i) {
+        EXPECT_EQ(outputs[i], QByteArray("thread ") + QByteArray::number(i) + "\n");
+    }
+}
+
+// =============================================================================
+// LoadOptions
+// =============================================================================
+
+TEST(LoadOptionsTest, CaptureOnFailedLoad_StillReportsError) {
+    LoadOptions options;
+    options.output = LoadOptions::Capture;
+    QString error;
+    LogosModule module = LogosModule::loadFromPath(QString("/nonexistent/path/to/plugin.so"),
+                                                   options, &error);
+
+    EXPECT_FALSE(module.isValid());
+    EXPECT_FALSE(error.isEmpty());
+}
+
+TEST(LoadOptionsTest, Inherit_CapturesNothing) {
+    std::string error;
+    LogosModule module = LogosModule::loadFromPath(std::string("/nonexistent/path/to/plugin.so"),
+                                                   LoadOptions(), &error);
+
+    EXPECT_FALSE(module.isValid());
+    EXPECT_FALSE(error.empty());
+    EXPECT_TRUE(module.capturedOutput().isEmpty());
+}
@@ -0,0 +1,55 @@
+#ifndef TEST_PLUGIN_PATH_H
+#define TEST_PLUGIN_PATH_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+// Locate the example plugin shipped in tests/examples: $TEST_PLUGIN first,
+// then the usual locations relative to the workspace / build directory.
+// Returns an empty string if it cannot be found.
+inline std::string findTestPlugin() {
+#ifdef __APPLE__
+    const std::string pluginName = "package_manager_plugin.dylib";
+#else
+    const std::string pluginName = "package_manager_plugin.so";
+#endif
+
+    const char* envPlugin = std::getenv("TEST_PLUGIN");
+    if (envPlugin && std::string(envPlugin).length() > 0) {
+        return envPlugin;
+    }
+
+    const std::vector<std::string> possiblePaths = {
+        "tests/examples/" + pluginName,
+        "../tests/examples/" + pluginName,
+        "../../tests/examples/" + pluginName,
+        "../../../tests/examples/" + pluginName,
+        "examples/" + pluginName,
+    };
+    for (const auto& path : possiblePaths) {
+        if (QFile::exists(QString::fromStdString(path))) {
+            return path;
+        }
+    }
+    return {};
+}
+
+// File suffix of the example plugin ("so" / "dylib"), for naming copies of it.
+inline QString testPluginSuffix(const std::string& testPlugin) {
+    return QString::fromStdString(testPlugin).section('.', -1);
+}
+
+// Write (or overwrite) a fixture file; false if it could not be written in full.
+inline bool writeFile(const QString& path, const QByteArray& content) {
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        return false;
+    }
+    return file.write(content) == content.size();
+}
+
+#endif // TEST_PLUGIN_PATH_H